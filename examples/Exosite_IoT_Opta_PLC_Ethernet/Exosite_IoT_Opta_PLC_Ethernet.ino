@@ -71,9 +71,6 @@ String deviceToken;
 
 String responseString;
 
-JSONVar writeJson;
-String writeString;
-
 ApiResponse res;
 
 ExositeHTTP exosite(&sslClient, CONNECTOR_DOMAIN);
@@ -99,6 +96,9 @@ void setup() {
 
   Serial.println(F("setup | Start"));
 
+  // Buffer library log records, printing them while idle (see: `loop()`)
+  ExositeLog::setDeferred(true);
+
   // If Hardware Security Module (HSM) not present, halt execution
   if (!ECCX08.begin()) {
     Serial.println(F("setup | No ECCX08 present - troubleshoot and reboot!"));
@@ -192,13 +192,10 @@ void loop() {
   //                               Data Publishing
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-  if (buildWriteJson(writeJson)) {
-    writeString = JSON.stringify(writeJson);
-
-    Serial.print(F("loop | Writing data to the cloud: "));
-    Serial.println(writeString);
+  if (buildChannels()) {
+    Serial.println(F("loop | Writing data to the cloud..."));
 
-    res = exosite.write(dataResource, writeString);
+    res = exosite.writeChannels(dataResource.c_str());
 
     if (!res.success) {
       Serial.print(F("loop | Failed to write data to the cloud ("));
@@ -207,15 +204,21 @@ void loop() {
     }
   }
   else {
-    Serial.println(F("loop | Failed to build JSON payload"));
+    Serial.println(F("loop | Failed to build channel payload"));
   }
 
   Serial.print(F("loop | Delaying: ~"));
   Serial.print(LOOP_DELAY);
   Serial.println(F("ms"));
 
-  writeJson = JSONVar();
-  delay(LOOP_DELAY);
+  // While idle, print buffered log records and re-open the cloud connection ahead of the next
+  // write (if closed)
+  unsigned long idleStart = millis();
+  while (millis() - idleStart < LOOP_DELAY) {
+    ExositeLog::drain();
+    exosite.prewarm();
+    delay(100);
+  }
   checkNetwork();
 
   Serial.println(F("loop | End"));
@@ -225,23 +228,20 @@ void loop() {
  *                                            EXOSITE
  *==============================================================================================*/
 
+// Builds the channel payload (e.g. {"001":1,...,"005":2.41}) for `writeChannels()`
 // Returns true if successful, otherwise false
-bool buildWriteJson(JSONVar& output) {
+bool buildChannels() {
   int* digitalInputStates = readDigitalInputs();
   float* analogInputStates = readAnalogInputs();
 
-  output["001"] = digitalInputStates[0];
-  output["002"] = digitalInputStates[1];
-  output["003"] = digitalInputStates[2];
-  output["004"] = digitalInputStates[3];
-  output["005"] = analogInputStates[0];
-
-  // Confirm that all keys are present
-  return output.hasOwnProperty("001") &&
-         output.hasOwnProperty("002") &&
-         output.hasOwnProperty("003") &&
-         output.hasOwnProperty("004") &&
-         output.hasOwnProperty("005");
+  exosite.beginChannels();
+
+  // Confirm that all channels fit in the library's internal buffer
+  return exosite.addChannel("001", digitalInputStates[0]) &&
+         exosite.addChannel("002", digitalInputStates[1]) &&
+         exosite.addChannel("003", digitalInputStates[2]) &&
+         exosite.addChannel("004", digitalInputStates[3]) &&
+         exosite.addChannel("005", analogInputStates[0], 2);
 }
 
 void handleResponse(const String& resource, String& response) {
@@ -0,0 +1,527 @@
+//************************************************************************************************
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Exosite
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//************************************************************************************************
+
+#include "ExositeDeflate.h"
+
+// Length symbols (257..285): base lengths and extra bits
+static const uint16_t LENGTH_BASE[] = {
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t LENGTH_EXTRA[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+// Distance symbols (0..29): base distances and extra bits
+static const uint16_t DIST_BASE[] = {
+  1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+  257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t DIST_EXTRA[] = {
+  0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+  7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+static const unsigned int MIN_MATCH = 3;
+static const unsigned int MAX_MATCH = 258;
+static const unsigned int MAX_DISTANCE = 32768;
+static const unsigned int HASH_SIZE = 256;
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+ExositeDeflate::ExositeDeflate(DeflateSink sink, void* context) {
+  _sink = sink;
+  _context = context;
+
+  // zlib header (deflate, 32 KB window, no dictionary)
+  putByte(0x78);
+  putByte(0x01);
+
+  // Single final block, fixed Huffman codes
+  putBits(1, 1);
+  putBits(1, 2);
+}
+
+void ExositeDeflate::literals(const uint8_t* data, size_t len) {
+  adler(data, len);
+  for (size_t i = 0; i < len; i++) {
+    putLiteral(data[i]);
+  }
+}
+
+void ExositeDeflate::compress(const uint8_t* data, size_t len) {
+  adler(data, len);
+
+  // Most recent position (+1) of each 3-byte hash (0 if none)
+  uint16_t head[HASH_SIZE];
+  memset(head, 0, sizeof(head));
+
+  size_t pos = 0;
+  while (pos < len) {
+    unsigned int bestLength = 0;
+    size_t bestDistance = 0;
+
+    if (pos + MIN_MATCH <= len && pos < 0xFFFF) {
+      unsigned int hash = ((data[pos] << 4) ^ (data[pos + 1] << 2) ^ data[pos + 2]) & (HASH_SIZE - 1);
+      size_t candidate = head[hash];
+      head[hash] = pos + 1;
+
+      if (candidate && pos - (candidate - 1) <= MAX_DISTANCE) {
+        candidate--;
+        size_t maxLength = (len - pos < MAX_MATCH) ? len - pos : MAX_MATCH;
+        unsigned int length = 0;
+        while (length < maxLength && data[candidate + length] == data[pos + length]) {
+          length++;
+        }
+        if (length >= MIN_MATCH) {
+          bestLength = length;
+          bestDistance = pos - candidate;
+        }
+      }
+    }
+
+    if (bestLength) {
+      putMatch(bestLength, bestDistance);
+
+      // Index the positions within the match
+      for (size_t i = pos + 1; i < pos + bestLength && i + MIN_MATCH <= len && i < 0xFFFF; i++) {
+        unsigned int hash = ((data[i] << 4) ^ (data[i + 1] << 2) ^ data[i + 2]) & (HASH_SIZE - 1);
+        head[hash] = i + 1;
+      }
+      pos += bestLength;
+    }
+    else {
+      putLiteral(data[pos++]);
+    }
+  }
+}
+
+size_t ExositeDeflate::finish() {
+  putLiteral(256); // End of block
+
+  // Pad to a byte boundary
+  if (_bitCount > 0) {
+    putBits(0, 8 - _bitCount);
+  }
+
+  // zlib trailer (Adler-32, big-endian)
+  uint32_t checksum = (_adlerB << 16) | _adlerA;
+  putByte(checksum >> 24);
+  putByte(checksum >> 16);
+  putByte(checksum >> 8);
+  putByte(checksum);
+
+  if (_sink && _outLen) {
+    _sink(_out, _outLen, _context);
+  }
+  _outLen = 0;
+
+  return _total;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void ExositeDeflate::putBits(uint32_t value, unsigned int count) {
+  _bitBuffer |= value << _bitCount;
+  _bitCount += count;
+
+  while (_bitCount >= 8) {
+    putByte(_bitBuffer & 0xFF);
+    _bitBuffer >>= 8;
+    _bitCount -= 8;
+  }
+}
+
+void ExositeDeflate::putCode(uint32_t code, unsigned int length) {
+  // Huffman codes are packed starting with their most significant bit
+  uint32_t reversed = 0;
+  for (unsigned int i = 0; i < length; i++) {
+    reversed = (reversed << 1) | ((code >> i) & 1);
+  }
+  putBits(reversed, length);
+}
+
+void ExositeDeflate::putByte(uint8_t byte) {
+  _out[_outLen++] = byte;
+  _total++;
+
+  if (_outLen == sizeof(_out)) {
+    if (_sink) {
+      _sink(_out, _outLen, _context);
+    }
+    _outLen = 0;
+  }
+}
+
+void ExositeDeflate::putLiteral(unsigned int symbol) {
+  if (symbol < 144) {
+    putCode(0x30 + symbol, 8);
+  }
+  else if (symbol < 256) {
+    putCode(0x190 + (symbol - 144), 9);
+  }
+  else if (symbol < 280) {
+    putCode(symbol - 256, 7);
+  }
+  else {
+    putCode(0xC0 + (symbol - 280), 8);
+  }
+}
+
+void ExositeDeflate::putMatch(unsigned int length, unsigned int distance) {
+  unsigned int code = 28;
+  while (LENGTH_BASE[code] > length) {
+    code--;
+  }
+  putLiteral(257 + code);
+  putBits(length - LENGTH_BASE[code], LENGTH_EXTRA[code]);
+
+  code = 29;
+  while (DIST_BASE[code] > distance) {
+    code--;
+  }
+  putCode(code, 5);
+  putBits(distance - DIST_BASE[code], DIST_EXTRA[code]);
+}
+
+void ExositeDeflate::adler(const uint8_t* data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    _adlerA = (_adlerA + data[i]) % 65521;
+    _adlerB = (_adlerB + _adlerA) % 65521;
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+//                                           Inflate
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+namespace {
+
+struct HuffmanTree {
+  uint16_t counts[16];   // Number of codes of each length
+  uint16_t symbols[288]; // Symbols ordered by code
+};
+
+struct InflateState {
+  const uint8_t* src;
+  size_t srcLen;
+  size_t srcPos;
+  uint32_t bitBuffer;
+  unsigned int bitCount;
+
+  uint8_t* dest;
+  size_t destSize;
+  size_t destPos;
+  bool overlap;  // Whether `dest` overlaps (and precedes) `src`
+
+  bool error;
+};
+
+uint32_t getBits(InflateState& s, unsigned int count) {
+  while (s.bitCount < count) {
+    if (s.srcPos >= s.srcLen) {
+      s.error = true;
+      return 0;
+    }
+    s.bitBuffer |= (uint32_t)s.src[s.srcPos++] << s.bitCount;
+    s.bitCount += 8;
+  }
+
+  uint32_t value = s.bitBuffer & ((1UL << count) - 1);
+  s.bitBuffer >>= count;
+  s.bitCount -= count;
+  return value;
+}
+
+bool putOutput(InflateState& s, uint8_t byte) {
+  // When decompressing in place, the output must not overtake the unread input
+  if (s.destPos >= s.destSize || (s.overlap && s.dest + s.destPos >= s.src + s.srcPos)) {
+    s.error = true;
+    return false;
+  }
+  s.dest[s.destPos++] = byte;
+  return true;
+}
+
+void buildTree(HuffmanTree& tree, const uint8_t* lengths, unsigned int count) {
+  uint16_t offsets[16];
+
+  memset(tree.counts, 0, sizeof(tree.counts));
+  for (unsigned int i = 0; i < count; i++) {
+    tree.counts[lengths[i]]++;
+  }
+  tree.counts[0] = 0;
+
+  offsets[1] = 0;
+  for (unsigned int len = 1; len < 15; len++) {
+    offsets[len + 1] = offsets[len] + tree.counts[len];
+  }
+
+  for (unsigned int i = 0; i < count; i++) {
+    if (lengths[i]) {
+      tree.symbols[offsets[lengths[i]]++] = i;
+    }
+  }
+}
+
+int decodeSymbol(InflateState& s, const HuffmanTree& tree) {
+  int code = 0;
+  int first = 0;
+  int index = 0;
+
+  for (unsigned int len = 1; len < 16; len++) {
+    code |= getBits(s, 1);
+    int count = tree.counts[len];
+    if (code - count < first) {
+      return tree.symbols[index + (code - first)];
+    }
+    index += count;
+    first += count;
+    first <<= 1;
+    code <<= 1;
+  }
+
+  s.error = true;
+  return -1;
+}
+
+bool inflateCodes(InflateState& s, const HuffmanTree& lengthTree, const HuffmanTree& distTree) {
+  while (!s.error) {
+    int symbol = decodeSymbol(s, lengthTree);
+
+    if (symbol < 0) {
+      break;
+    }
+    else if (symbol < 256) {
+      putOutput(s, symbol);
+    }
+    else if (symbol == 256) {
+      return true; // End of block
+    }
+    else {
+      symbol -= 257;
+      if (symbol >= 29) {
+        break;
+      }
+      unsigned int length = LENGTH_BASE[symbol] + getBits(s, LENGTH_EXTRA[symbol]);
+
+      int distSymbol = decodeSymbol(s, distTree);
+      if (distSymbol < 0 || distSymbol >= 30) {
+        break;
+      }
+      size_t distance = DIST_BASE[distSymbol] + getBits(s, DIST_EXTRA[distSymbol]);
+      if (distance > s.destPos) {
+        break;
+      }
+
+      // Copy byte by byte, as the source may overlap the bytes being written
+      for (unsigned int i = 0; i < length && !s.error; i++) {
+        putOutput(s, s.dest[s.destPos - distance]);
+      }
+    }
+  }
+
+  s.error = true;
+  return false;
+}
+
+bool inflateStored(InflateState& s) {
+  // Discard the remaining bits of the current byte
+  s.bitBuffer = 0;
+  s.bitCount = 0;
+
+  if (s.srcPos + 4 > s.srcLen) {
+    return false;
+  }
+  unsigned int len = s.src[s.srcPos] | (s.src[s.srcPos + 1] << 8);
+  unsigned int nlen = s.src[s.srcPos + 2] | (s.src[s.srcPos + 3] << 8);
+  s.srcPos += 4;
+
+  if (len != (~nlen & 0xFFFF) || s.srcPos + len > s.srcLen) {
+    return false;
+  }
+
+  while (len--) {
+    // Consume the input byte before writing (for in-place decompression)
+    uint8_t byte = s.src[s.srcPos++];
+    if (!putOutput(s, byte)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool inflateFixed(InflateState& s) {
+  HuffmanTree lengthTree;
+  HuffmanTree distTree;
+  uint8_t lengths[288];
+
+  unsigned int i = 0;
+  for (; i < 144; i++) lengths[i] = 8;
+  for (; i < 256; i++) lengths[i] = 9;
+  for (; i < 280; i++) lengths[i] = 7;
+  for (; i < 288; i++) lengths[i] = 8;
+  buildTree(lengthTree, lengths, 288);
+
+  for (i = 0; i < 30; i++) lengths[i] = 5;
+  buildTree(distTree, lengths, 30);
+
+  return inflateCodes(s, lengthTree, distTree);
+}
+
+bool inflateDynamic(InflateState& s) {
+  static const uint8_t ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+  HuffmanTree lengthTree;
+  HuffmanTree distTree;
+  uint8_t lengths[288 + 32];
+
+  unsigned int hlit = getBits(s, 5) + 257;
+  unsigned int hdist = getBits(s, 5) + 1;
+  unsigned int hclen = getBits(s, 4) + 4;
+  if (s.error || hlit > 286 || hdist > 30) {
+    return false;
+  }
+
+  // Code length code lengths
+  memset(lengths, 0, 19);
+  for (unsigned int i = 0; i < hclen; i++) {
+    lengths[ORDER[i]] = getBits(s, 3);
+  }
+  buildTree(lengthTree, lengths, 19);
+
+  // Literal/length and distance code lengths
+  unsigned int count = 0;
+  while (count < hlit + hdist && !s.error) {
+    int symbol = decodeSymbol(s, lengthTree);
+    unsigned int repeat = 0;
+    uint8_t value = 0;
+
+    if (symbol < 0) {
+      return false;
+    }
+    else if (symbol < 16) {
+      lengths[count++] = symbol;
+      continue;
+    }
+    else if (symbol == 16) {
+      if (count == 0) {
+        return false;
+      }
+      value = lengths[count - 1];
+      repeat = 3 + getBits(s, 2);
+    }
+    else if (symbol == 17) {
+      repeat = 3 + getBits(s, 3);
+    }
+    else {
+      repeat = 11 + getBits(s, 7);
+    }
+
+    if (count + repeat > hlit + hdist) {
+      return false;
+    }
+    while (repeat--) {
+      lengths[count++] = value;
+    }
+  }
+
+  if (s.error) {
+    return false;
+  }
+
+  buildTree(lengthTree, lengths, hlit);
+  buildTree(distTree, lengths + hlit, hdist);
+
+  return inflateCodes(s, lengthTree, distTree);
+}
+
+} // namespace
+
+long ExositeDeflate::inflate(const uint8_t* src, size_t srcLen, uint8_t* dest, size_t destSize) {
+  InflateState s;
+  s.src = src;
+  s.srcLen = srcLen;
+  s.srcPos = 0;
+  s.bitBuffer = 0;
+  s.bitCount = 0;
+  s.dest = dest;
+  s.destSize = destSize;
+  s.destPos = 0;
+  s.overlap = (dest <= src && dest + destSize > src);
+  s.error = false;
+
+  // Skip the stream wrapper (if any)
+  if (srcLen >= 10 && src[0] == 0x1F && src[1] == 0x8B) {
+    // gzip
+    uint8_t flags = src[3];
+    s.srcPos = 10;
+    if (flags & 0x04) { // FEXTRA
+      if (s.srcPos + 2 > srcLen) return -1;
+      s.srcPos += 2 + (src[s.srcPos] | (src[s.srcPos + 1] << 8));
+    }
+    if (flags & 0x08) { // FNAME
+      while (s.srcPos < srcLen && src[s.srcPos++]) {}
+    }
+    if (flags & 0x10) { // FCOMMENT
+      while (s.srcPos < srcLen && src[s.srcPos++]) {}
+    }
+    if (flags & 0x02) { // FHCRC
+      s.srcPos += 2;
+    }
+  }
+  else if (srcLen >= 2 && (src[0] & 0x0F) == 8 && ((src[0] << 8) | src[1]) % 31 == 0) {
+    // zlib (preset dictionaries are not supported)
+    if (src[1] & 0x20) {
+      return -1;
+    }
+    s.srcPos = 2;
+  }
+
+  bool final = false;
+  while (!final) {
+    final = getBits(s, 1);
+    unsigned int type = getBits(s, 2);
+
+    bool ok = false;
+    if (s.error) ok = false;
+    else if (type == 0) ok = inflateStored(s);
+    else if (type == 1) ok = inflateFixed(s);
+    else if (type == 2) ok = inflateDynamic(s);
+
+    if (!ok) {
+      return -1;
+    }
+  }
+
+  return s.destPos;
+}
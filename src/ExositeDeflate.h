@@ -0,0 +1,158 @@
+//************************************************************************************************
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Exosite
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Callback receiving compressed output (e.g. writing it to the client)
+ *
+ * @param data     Compressed data
+ * @param len      Length of the data
+ * @param context  Context pointer provided to `ExositeDeflate`
+ */
+typedef void (*DeflateSink)(const uint8_t* data, size_t len, void* context);
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Fixed-memory deflate (zlib format) compressor, and in-place capable inflater
+ *
+ * Note:
+ *
+ * - Compression uses a single fixed-Huffman block and a 256-entry match table (512 B of stack),
+ *   and streams its output through a `DeflateSink` (so no output buffer is needed)
+ *
+ * - Inflation supports zlib, gzip, and raw deflate streams, using ~1.3 KB of stack
+ */
+class ExositeDeflate {
+  public:
+    /**
+     * @brief Begin a compressed (zlib) stream
+     *
+     * @param sink     Callback receiving the compressed output (or `nullptr` to only count it)
+     * @param context  (Optional) Context pointer passed to the sink
+     */
+    ExositeDeflate(DeflateSink sink, void* context=nullptr);
+
+    /**
+     * @brief Add data to the stream without searching for matches (e.g. a short prefix)
+     *
+     * @param data  Data to be compressed
+     * @param len   Length of the data
+     */
+    void literals(const uint8_t* data, size_t len);
+
+    /**
+     * @brief Add data to the stream, replacing repeated sequences with back-references
+     *
+     * Note: Back-references are only made within the provided data
+     *
+     * @param data  Data to be compressed
+     * @param len   Length of the data
+     */
+    void compress(const uint8_t* data, size_t len);
+
+    /**
+     * @brief End the compressed stream
+     *
+     * @return Total length of the compressed stream
+     */
+    size_t finish();
+
+    /**
+     * @brief Decompresses a zlib, gzip, or raw deflate stream
+     *
+     * Note:
+     *
+     * - `dest` may overlap `src`, as long as `dest` starts before it (i.e. `src` at the end of a
+     *   shared buffer), in which case decompression fails if the output would overtake the input
+     *
+     * - Stream checksums are not verified
+     *
+     * @param src       Compressed stream
+     * @param srcLen    Length of the compressed stream
+     * @param dest      Buffer in which to store the decompressed data
+     * @param destSize  Size of the destination buffer
+     *
+     * @return Length of the decompressed data, or `-1` on error (e.g. insufficient buffer)
+     */
+    static long inflate(const uint8_t* src, size_t srcLen, uint8_t* dest, size_t destSize);
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  private:
+    DeflateSink _sink;
+    void* _context;
+
+    uint32_t _bitBuffer = 0;
+    unsigned int _bitCount = 0;
+
+    uint8_t _out[32];   // Output staged for the sink
+    size_t _outLen = 0;
+    size_t _total = 0;
+
+    uint32_t _adlerA = 1; // Adler-32 checksum of the uncompressed data
+    uint32_t _adlerB = 0;
+
+    /**
+     * @brief Writes bits to the stream (least significant bit first)
+     */
+    void putBits(uint32_t value, unsigned int count);
+
+    /**
+     * @brief Writes a Huffman code to the stream (most significant bit first)
+     */
+    void putCode(uint32_t code, unsigned int length);
+
+    /**
+     * @brief Writes a byte to the stream, staging it for the sink
+     */
+    void putByte(uint8_t byte);
+
+    /**
+     * @brief Writes a literal (or end-of-block) symbol using the fixed Huffman code
+     */
+    void putLiteral(unsigned int symbol);
+
+    /**
+     * @brief Writes a length/distance back-reference using the fixed Huffman code
+     */
+    void putMatch(unsigned int length, unsigned int distance);
+
+    /**
+     * @brief Updates the Adler-32 checksum with the provided (uncompressed) data
+     */
+    void adler(const uint8_t* data, size_t len);
+};
@@ -31,6 +31,9 @@
 
 #include "ExositeHTTP.h"
 
+#include <errno.h>
+#include <float.h>
+
 ExositeHTTP::ExositeHTTP(Client* client, const char* connector) {
   _client = client;
   setDomain(connector);
@@ -68,10 +71,99 @@ void ExositeHTTP::setTimeout(const unsigned long rxTimeoutMs) {
   _rxTimeout = rxTimeoutMs;
 }
 
+void ExositeHTTP::setEncoding(UrlEncoding encoding) {
+  _encoding = encoding;
+}
+
+void ExositeHTTP::setCompression(bool enabled, size_t minLength) {
+  _compress = enabled;
+  _compressMin = minLength;
+}
+
+void ExositeHTTP::setRequestBudget(unsigned long budgetMs) {
+  _budget = budgetMs;
+}
+
+BufferStats ExositeHTTP::getBufferStats() {
+  return _bufferStats;
+}
+
+void ExositeHTTP::resetBufferStats() {
+  memset(&_bufferStats, 0, sizeof(_bufferStats));
+}
+
+void ExositeHTTP::setSessionCache(TlsSessionCache* cache) {
+  _sessionCache = cache;
+}
+
+unsigned long ExositeHTTP::lastRoundTrip() {
+  return _responded ? _firstByte - _requestStart : 0;
+}
+
+ConnectionStats ExositeHTTP::getConnectionStats() {
+  return _connectionStats;
+}
+
+void ExositeHTTP::setResolver(HostResolver resolver, AddressConnector connector, unsigned long defaultTtl) {
+  _resolver = resolver;
+  _addressConnector = connector;
+  _dnsDefaultTtl = defaultTtl;
+  _dnsValid = false;
+}
+
+void ExositeHTTP::setReportByException(bool enabled, unsigned long heartbeatMs) {
+  _rbeEnabled = enabled;
+  _rbeHeartbeat = heartbeatMs;
+}
+
+bool ExositeHTTP::setDeadband(const char* channel, float deadband) {
+  if (!channel) {
+    return false;
+  }
+
+  // Update the existing entry, if any
+  for (unsigned int i = 0; i < _rbeChannelCount; i++) {
+    if (strcmp(_rbeChannels[i].key, channel) == 0) {
+      _rbeChannels[i].deadband = deadband;
+      return true;
+    }
+  }
+
+  if (_rbeChannelCount >= EXO_RBE_MAX_CHANNELS || strlen(channel) >= sizeof(_rbeChannels[0].key)) {
+    LOG_ERROR(G("Cannot set deadband for channel: "), channel);
+    return false;
+  }
+
+  RbeChannel& entry = _rbeChannels[_rbeChannelCount++];
+  strcpy(entry.key, channel);
+  entry.deadband = deadband;
+  entry.hasPending = false;
+  return true;
+}
+
+void ExositeHTTP::clearReportHistory() {
+  for (unsigned int i = 0; i < EXO_RBE_MAX_RESOURCES; i++) {
+    _rbeResources[i].used = false;
+  }
+}
+
+ReportStats ExositeHTTP::getReportStats() {
+  return _rbeStats;
+}
+
+void ExositeHTTP::setClockTolerance(unsigned long maxErrorMs, unsigned long driftPpm) {
+  _clockMaxError = maxErrorMs;
+  _clockDriftPpm = driftPpm;
+}
+
 void ExositeHTTP::flushClient() {
   unsigned long start = millis();
 
   while ((millis() - start) < _flushTimeout) {
+    if (budgetRemaining() == 0) {
+      _client->stop(); // Drop the connection rather than exceed the budget
+      return;
+    }
     while (_client->available()) {
       _client->read();
       start = millis(); // Reset timeout as more data is available
@@ -81,12 +173,183 @@ void ExositeHTTP::flushClient() {
 }
 
 bool ExositeHTTP::isConnected() {
+  // Start the time budget of the API call (see: `setRequestBudget()`)
+  unsigned long now = millis();
+  _deadlineStart = now;
+  _deadlineExtra = 0;
+  _responded = false;
+
+  // Track the request schedule (see: `prewarm()`)
+  if (_requestSamples > 0) {
+    unsigned long interval = now - _lastRequestAt;
+    _requestInterval = (_requestSamples > 1) ? (_requestInterval * 3 + interval) / 4 : interval;
+  }
+  if (_requestSamples < 2) {
+    _requestSamples++;
+  }
+  _lastRequestAt = now;
+  _prewarmed = false;
+
+  if (_client->connected()) {
+    _connectionStats.warmHits++;
+    return true;
+  }
+
+  _connectionStats.coldStarts++;
+  return openConnection();
+}
+
+bool ExositeHTTP::prewarm(unsigned long leadMs) {
+  if (_client->connected()) {
+    return true;
+  }
+
+  // Wait until the next request is expected (within the lead time), connecting once per request
+  if (_prewarmed || _requestSamples < 2 || (millis() - _lastRequestAt) + leadMs < _requestInterval) {
+    return false;
+  }
+
+  LOG_DEBUG(G("Pre-warming connection"));
+  _prewarmed = true;
+  _deadlineStart = millis(); // Pre-warming has its own time budget
+  _deadlineExtra = 0;
+
+  if (openConnection()) {
+    _connectionStats.prewarms++;
+    return true;
+  }
+
+  return false;
+}
+
+bool ExositeHTTP::openConnection() {
   if (!_client->connected()) {
     LOG_DEBUG(G("Opening client connection..."));
     _client->stop();
+
+    if (budgetExpired("connect")) {
+      return false;
+    }
+
+    // Bound blocking within the client by the budget (for this connection attempt only)
+    unsigned long clientTimeout = _client->getTimeout();
+    if (_budget) {
+      _client->setTimeout(budgetRemaining());
+    }
+
+    bool restored = _sessionCache && _sessionCache->restore(_client, _connector);
+
+    unsigned long start = millis();
+    bool connected = connectClient();
+    unsigned long elapsed = millis() - start;
+
+    _client->setTimeout(clientTimeout);
+
+    _connectionStats.lastConnectMs = elapsed;
+    _connectionStats.totalConnectMs += elapsed;
+
+    if (!connected) {
+      _connectionStats.connectFailures++;
+      return false;
+    }
+
+    _connectionStats.connects++;
+
+    if (_sessionCache) {
+      if (restored) {
+        _connectionStats.sessionRestores++;
+        if (_sessionCache->resumed(_client)) {
+          _connectionStats.sessionResumes++;
+        }
+      }
+      _sessionCache->save(_client, _connector);
+    }
+
+    LOG_DEBUG(G("Connected in "), elapsed, G(" ms"));
+  }
+
+  return true;
+}
+
+bool ExositeHTTP::connectClient() {
+  if (!_resolver) {
     return _client->connect(_connector, _port);
   }
 
+  uint32_t hostHash = fnv1a(_fnvOffset, _connector, strlen(_connector));
+  bool cached = _dnsValid && _dnsHostHash == hostHash;
+  bool hit = cached && !timeExpired(_dnsResolvedAt, _dnsTtlMs);
+
+  if (hit) {
+    _connectionStats.dnsHits++;
+    _connectionStats.dnsSavedMs += _dnsLookupMs;
+  }
+  else if (cached && budgetRemaining() <= _dnsLookupMs) {
+    LOG_DEBUG(G("Insufficient budget for address lookup, using last known address"));
+    _connectionStats.dnsStale++;
+  }
+  else {
+    _connectionStats.dnsMisses++;
+
+    IPAddress address;
+    unsigned long ttl = _dnsDefaultTtl;
+    unsigned long start = millis();
+    bool resolved = _resolver(_connector, address, ttl);
+    unsigned long elapsed = millis() - start;
+
+    if (resolved) {
+      cached = false; // Freshly resolved
+      _dnsLookupMs = _dnsLookupMs ? (_dnsLookupMs * 3 + elapsed) / 4 : elapsed;
+      _dnsValid = true;
+      _dnsHostHash = hostHash;
+      _dnsAddress = address;
+      _dnsResolvedAt = millis();
+      _dnsTtlMs = (ttl < 86400UL ? ttl : 86400UL) * 1000; // Cap at one day (and avoid overflow)
+    }
+    else if (cached) {
+      LOG_DEBUG(G("Address lookup failed, using last known address"));
+      _connectionStats.dnsStale++;
+    }
+    else {
+      LOG_ERROR(G("Failed to resolve: "), _connector);
+      return _client->connect(_connector, _port);
+    }
+  }
+
+  bool connected = _addressConnector ? _addressConnector(_client, _dnsAddress, _connector, _port)
+                                     : _client->connect(_dnsAddress, _port);
+
+  if (!connected) {
+    // The server may have moved, so the address is looked up again (rather than reused until expiry)
+    _dnsValid = false;
+    if (hit) {
+      _connectionStats.dnsSavedMs -= _dnsLookupMs; // The lookup is needed after all
+    }
+    if (cached) {
+      LOG_DEBUG(G("Failed to connect to cached address, resolving again"));
+      return connectClient();
+    }
+  }
+
+  return connected;
+}
+
+unsigned long ExositeHTTP::budgetRemaining() {
+  if (!_budget) {
+    return (unsigned long)-1;
+  }
+
+  unsigned long elapsed = millis() - _deadlineStart;
+  unsigned long budget = _budget + _deadlineExtra;
+  return (elapsed < budget) ? budget - elapsed : 0;
+}
+
+bool ExositeHTTP::budgetExpired(const char* phase) {
+  if (budgetRemaining() > 0) {
+    return false;
+  }
+
+  LOG_ERROR(G("Request budget exhausted before "), phase, G(" ("), _budget, G(" ms)"));
   return true;
 }
 
@@ -94,9 +357,201 @@ bool ExositeHTTP::timeExpired(unsigned long start, unsigned long duration) {
   return (millis() - start) >= duration;
 }
 
+uint32_t ExositeHTTP::fnv1a(uint32_t hash, const char* data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    hash ^= (uint8_t)data[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+void ExositeHTTP::rbeStageValue(const char* value) {
+  _rbeValueHash = _fnvOffset;
+  for (unsigned int i = 0; i < _rbeChannelCount; i++) {
+    _rbeChannels[i].hasPending = false;
+  }
+
+  // Walk the value as a flat JSON object (e.g. `{"001":1,"005":2.41}`)
+  const char* p = value;
+  bool flat = false;
+
+  while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+
+  if (*p++ == '{') {
+    while (true) {
+      while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+      if (*p == '}') {
+        flat = true;
+        break;
+      }
+
+      // Key
+      if (*p++ != '"') break;
+      const char* key = p;
+      while (*p && *p != '"') {
+        if (*p == '\\' && p[1]) p++;
+        p++;
+      }
+      if (*p != '"') break;
+      size_t keyLen = p++ - key;
+
+      while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+      if (*p++ != ':') break;
+      while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+
+      // Value (nested objects/arrays are not supported)
+      const char* field = p;
+      if (*p == '"') {
+        p++;
+        while (*p && *p != '"') {
+          if (*p == '\\' && p[1]) p++;
+          p++;
+        }
+        if (*p++ != '"') break;
+      }
+      else {
+        while (*p && *p != ',' && *p != '}' && *p != '{' && *p != '[' &&
+               *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') p++;
+        if (p == field || *p == '{' || *p == '[') break;
+      }
+      rbeStageField(key, keyLen, field, p - field);
+
+      while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+      if (*p == ',') p++;
+      else if (*p != '}') break;
+    }
+  }
+
+  if (!flat) {
+    // Not a flat JSON object, so compare the value as a whole
+    _rbeValueHash = fnv1a(_fnvOffset, value, strlen(value));
+    for (unsigned int i = 0; i < _rbeChannelCount; i++) {
+      _rbeChannels[i].hasPending = false;
+    }
+  }
+}
+
+void ExositeHTTP::rbeStageField(const char* key, size_t keyLen, const char* value, size_t valueLen) {
+  _rbeValueHash = fnv1a(_rbeValueHash, key, keyLen);
+  _rbeValueHash = fnv1a(_rbeValueHash, ":", 1);
+
+  // Numeric values of deadband channels are compared separately
+  for (unsigned int i = 0; i < _rbeChannelCount; i++) {
+    RbeChannel& channel = _rbeChannels[i];
+    if (strlen(channel.key) == keyLen && strncmp(channel.key, key, keyLen) == 0) {
+      char* end = nullptr;
+      float number = strtod(value, &end);
+      if (end == value + valueLen) {
+        channel.pending = number;
+        channel.hasPending = true;
+        _rbeValueHash = fnv1a(_rbeValueHash, ",", 1);
+        return;
+      }
+      break;
+    }
+  }
+
+  _rbeValueHash = fnv1a(_rbeValueHash, value, valueLen);
+  _rbeValueHash = fnv1a(_rbeValueHash, ",", 1);
+}
+
+bool ExositeHTTP::rbeShouldSend(const char* resource) {
+  uint32_t aliasHash = fnv1a(_fnvOffset, resource, strlen(resource));
+
+  // Find the resource entry (or claim an unused one)
+  _rbeActive = -1;
+  _rbeHeartbeatDue = false;
+  for (int i = 0; i < EXO_RBE_MAX_RESOURCES; i++) {
+    if (_rbeResources[i].used && _rbeResources[i].aliasHash == aliasHash) {
+      _rbeActive = i;
+      break;
+    }
+  }
+
+  if (_rbeActive < 0) {
+    for (int i = 0; i < EXO_RBE_MAX_RESOURCES; i++) {
+      if (!_rbeResources[i].used) {
+        _rbeResources[i].aliasHash = aliasHash;
+        _rbeResources[i].hasValues = 0;
+        _rbeActive = i;
+        break;
+      }
+    }
+    return true; // First write of the resource (or table full, so untracked)
+  }
+
+  RbeResource& entry = _rbeResources[_rbeActive];
+
+  bool changed = (entry.valueHash != _rbeValueHash);
+  for (unsigned int i = 0; i < _rbeChannelCount && !changed; i++) {
+    const RbeChannel& channel = _rbeChannels[i];
+    if (channel.hasPending) {
+      changed = !(entry.hasValues & (1UL << i)) || fabs(channel.pending - entry.values[i]) > channel.deadband;
+    }
+  }
+
+  if (changed) {
+    return true;
+  }
+  else if (_rbeHeartbeat && timeExpired(entry.lastSent, _rbeHeartbeat)) {
+    _rbeHeartbeatDue = true; // Counted once the write succeeds (see: `rbeCommit()`)
+    return true;
+  }
+
+  _rbeStats.suppressed++;
+  return false;
+}
+
+void ExositeHTTP::rbeCommit() {
+  _rbeStats.sent++;
+  if (_rbeHeartbeatDue) {
+    _rbeStats.heartbeats++;
+    _rbeHeartbeatDue = false;
+  }
+
+  if (_rbeActive < 0) {
+    return;
+  }
+
+  RbeResource& entry = _rbeResources[_rbeActive];
+  entry.used = true;
+  entry.valueHash = _rbeValueHash;
+  entry.lastSent = millis();
+
+  for (unsigned int i = 0; i < _rbeChannelCount; i++) {
+    if (_rbeChannels[i].hasPending) {
+      entry.values[i] = _rbeChannels[i].pending;
+      entry.hasValues |= (1UL << i);
+    }
+  }
+
+  _rbeActive = -1;
+}
+
+void ExositeHTTP::rbeForget(const char* resource) {
+  if (!_rbeEnabled || !resource) {
+    return;
+  }
+
+  uint32_t aliasHash = fnv1a(_fnvOffset, resource, strlen(resource));
+  for (int i = 0; i < EXO_RBE_MAX_RESOURCES; i++) {
+    if (_rbeResources[i].used && _rbeResources[i].aliasHash == aliasHash) {
+      _rbeResources[i].used = false;
+      return;
+    }
+  }
+}
+
 bool ExositeHTTP::readHttpResponse(char* buffer, size_t bufferSize, unsigned long timeoutMs) {
   unsigned long startTime = millis();
 
+  // Bound the timeout by the remaining time budget (see: `setRequestBudget()`)
+  unsigned long remaining = budgetRemaining();
+  bool budgetBound = (remaining < timeoutMs);
+  if (budgetBound) {
+    timeoutMs = remaining;
+  }
+
   const size_t maxSize = bufferSize - 1;
 
   char c;
@@ -111,20 +566,31 @@ bool ExositeHTTP::readHttpResponse(char* buffer, size_t bufferSize, unsigned lon
   while (true) {
     // Timeout check
     if (timeExpired(startTime, timeoutMs)) {
-      LOG_ERROR(G("Timed out processing HTTP response"));
-      flushClient(); // Flush any remaining data
+      if (budgetBound) {
+        LOG_ERROR(G("Request budget exhausted while receiving (ms): "), _budget);
+        _client->stop(); // The rest of the response can no longer be consumed
+      }
+      else {
+        LOG_ERROR(G("Timed out processing HTTP response"));
+        flushClient(); // Flush any remaining data
+      }
       break;
     }
     // Read data as it becomes available
     else if (_client->available()) {
       // Size check
       if (pos < maxSize) {
+        if (!dataReceived) {
+          _firstByte = millis();
+          _responded = true;
+        }
         dataReceived = true;
         c = _client->read();
         buffer[pos++] = c;
       }
       else {
         LOG_ERROR(G("Request response is larger than internal buffer allocation (≥"), bufferSize, G(" B)"));
+        _bufferStats.overflows++;
         flushClient(); // Flush any remaining data
         break;
       }
@@ -140,160 +606,1317 @@ bool ExositeHTTP::readHttpResponse(char* buffer, size_t bufferSize, unsigned lon
 
   buffer[pos] = '\0'; // Always null terminate
 
+  if (fullyParsed) {
+    trackResponse(buffer, bufferSize, pos);
+    clockSampleDate(buffer);
+    fullyParsed = decodeContent(buffer, bufferSize, pos);
+  }
+
   return fullyParsed;
 }
 
-void ExositeHTTP::sendGetRequest(const char* path, const char* resource, const char* clientAuth, const char* pollHeaders) {
-  _client->print(G("GET "));
-  _client->print(path);
-  if (resource) {
-    _client->print("?");
-    _client->print(resource);
+bool ExositeHTTP::readFramedResponse(char* buffer, size_t bufferSize, unsigned long timeoutMs) {
+  unsigned long startTime = millis();
+
+  // Bound the timeout by the remaining time budget (see: `setRequestBudget()`)
+  unsigned long remaining = budgetRemaining();
+  if (remaining < timeoutMs) {
+    timeoutMs = remaining;
   }
-  _client->println(G(" HTTP/1.1"));
 
-  _client->print(G("Host: "));
-  _client->println(_connector);
+  const size_t maxSize = bufferSize - 1;
 
-  _client->print(G("User-Agent: ExositeHTTP-Cpp/"));
-  _client->print(ACTIVATOR_VERSION);
-  _client->print(G(" Arduino/"));
-  _client->println(ARDUINO);
+  size_t pos = 0;
+  size_t headerEnd = 0;
+  size_t contentLength = 0;
 
-  _client->println(G("Accept: application/x-www-form-urlencoded; charset=utf-8"));
+  buffer[0] = '\0';
 
-  if (clientAuth) {
-    // Add authorization header
-    _client->print(G("Authorization: token "));
-    _client->println(clientAuth);
+  while (headerEnd == 0 || pos < headerEnd + contentLength) {
+    if (timeExpired(startTime, timeoutMs)) {
+      LOG_ERROR(G("Timed out processing HTTP response"));
+      buffer[pos] = '\0';
+      return false;
+    }
+    else if (!_client->available()) {
+      if (!_client->connected()) {
+        LOG_DEBUG(G("Connection closed by server"));
+        buffer[pos] = '\0';
+        return false;
+      }
+      delay(1); // Small wait for more data to arrive
+      continue;
+    }
+    else if (pos >= maxSize) {
+      LOG_ERROR(G("Request response is larger than internal buffer allocation (≥"), bufferSize, G(" B)"));
+      _bufferStats.overflows++;
+      buffer[pos] = '\0';
+      return false;
+    }
+
+    if (pos == 0) {
+      _firstByte = millis();
+      _responded = true;
+    }
+    buffer[pos++] = _client->read();
+
+    // At the end of the headers, determine the length of the body
+    if (headerEnd == 0 && pos >= 4 && memcmp(buffer + pos - 4, "\r\n\r\n", 4) == 0) {
+      headerEnd = pos;
+      buffer[pos] = '\0';
+
+      int statusCode = 0;
+      sscanf(buffer, "HTTP/1.1 %d", &statusCode);
+
+      const char* length = findHeader(buffer, "Content-Length");
+      if (length) {
+        contentLength = strtoul(length, nullptr, 10);
+      }
+      else if (statusCode != 204 && statusCode != 304 && (statusCode < 100 || statusCode >= 200)) {
+        LOG_DEBUG(G("Response has no Content-Length"));
+        return false;
+      }
+    }
   }
 
-  if (pollHeaders) {
-    _client->println(pollHeaders);  // e.g. "If-Modified-Since: 0\r\nRequest-Timeout: 5000"
+  buffer[pos] = '\0';
+  trackResponse(buffer, bufferSize, pos);
+  clockSampleDate(buffer);
+
+  return decodeContent(buffer, bufferSize, pos);
+}
+
+int ExositeHTTP::readResponseByte(unsigned long startTime, unsigned long timeoutMs) {
+  while (!_client->available()) {
+    if (timeExpired(startTime, timeoutMs)) {
+      LOG_ERROR(G("Timed out processing HTTP response"));
+      return -1;
+    }
+    else if (!_client->connected()) {
+      LOG_DEBUG(G("Connection closed by server"));
+      return -1;
+    }
+    delay(1); // Small wait for more data to arrive
   }
 
-  _client->println();  // End of headers
+  if (!_responded) {
+    _firstByte = millis();
+    _responded = true;
+  }
+  return _client->read();
 }
 
-void ExositeHTTP::sendPostRequest(const char* path, const char* key, const char* value, const char* clientAuth) {
-  _client->print(G("POST "));
-  _client->print(path);
-  _client->println(G(" HTTP/1.1"));
+void ExositeHTTP::trackUsage(size_t& highWater, size_t used, size_t capacity) {
+  if (used > highWater) {
+    highWater = used;
+  }
 
-  _client->print(G("Host: "));
-  _client->println(_connector);
+  if (capacity && used * 10 >= capacity * 9) {
+    _bufferStats.nearMisses++;
+  }
+}
 
-  _client->print(G("User-Agent: ExositeHTTP-Cpp/"));
-  _client->print(ACTIVATOR_VERSION);
-  _client->print(G(" Arduino/"));
-  _client->println(ARDUINO);
+void ExositeHTTP::trackResponse(const char* buffer, size_t bufferSize, size_t length) {
+  const char* body = strstr(buffer, "\r\n\r\n");
+  size_t headerLen = body ? (body - buffer) + 4 : length;
 
-  _client->println(G("Accept: application/x-www-form-urlencoded; charset=utf-8"));
-  _client->println(G("Content-Type: application/x-www-form-urlencoded; charset=utf-8"));
+  if (headerLen > _bufferStats.headerHighWater) {
+    _bufferStats.headerHighWater = headerLen;
+  }
+  trackUsage(_bufferStats.bodyHighWater, length - headerLen, bufferSize - 1 - headerLen);
+}
 
-  // Compute content length
-  size_t contentLength = (key ? strlen(key) : 0) + strlen("=") + (value ? strlen(value) : 0);
-  _client->print(G("Content-Length: "));
-  _client->println(contentLength);
+bool ExositeHTTP::decodeContent(char* buffer, size_t bufferSize, size_t length) {
+  const char* encoding = findHeader(buffer, "Content-Encoding");
+  if (!encoding || strncasecmp(encoding, "identity", 8) == 0) {
+    return true;
+  }
+  else if (strncasecmp(encoding, "deflate", 7) != 0 && strncasecmp(encoding, "gzip", 4) != 0) {
+    LOG_ERROR(G("Unsupported response Content-Encoding"));
+    return false;
+  }
 
-  if (clientAuth) {
-    // Add authorization header
-    _client->print(G("Authorization: token "));
-    _client->println(clientAuth);
+  char* body = strstr(buffer, "\r\n\r\n"); // Assume body starts after double CRLF
+  if (!body) {
+    return false;
   }
-  _client->println();  // End of headers
+  body += 4;
+
+  // Move the compressed body to the end of the buffer, then inflate it towards the front
+  size_t offset = body - buffer;
+  size_t compressedLen = length - offset;
+  char* compressed = buffer + bufferSize - compressedLen;
+  memmove(compressed, body, compressedLen);
+
+  long decodedLen = ExositeDeflate::inflate((const uint8_t*)compressed, compressedLen,
+                                            (uint8_t*)body, bufferSize - 1 - offset);
+  if (decodedLen < 0) {
+    LOG_ERROR(G("Failed to decompress response (or larger than internal buffer: ≥"), bufferSize, G(" B)"));
+    _bufferStats.overflows++;
+    body[0] = '\0';
+    return false;
+  }
+
+  body[decodedLen] = '\0';
+  trackUsage(_bufferStats.bodyHighWater, decodedLen, bufferSize - 1 - offset);
+  LOG_DEBUG(G("Decompressed response body: "), compressedLen, G(" -> "), decodedLen, G(" B"));
+  return true;
+}
+
+void ExositeHTTP::clientSink(const uint8_t* data, size_t len, void* context) {
+  static_cast<Client*>(context)->write(data, len);
+}
+
+void ExositeHTTP::clockSampleDate(const char* response) {
+  unsigned long serverTime;
+  const char* date = findHeader(response, "Date");
+  if (date && parseHttpDate(date, &serverTime)) {
+    clockSample(serverTime);
+  }
+}
+
+const char* ExositeHTTP::findHeader(const char* response, const char* name) {
+  size_t nameLen = strlen(name);
+
+  // Skip the status line
+  const char* line = strstr(response, "\r\n");
+
+  while (line && line[2] != '\r' && line[2] != '\0') {
+    line += 2;
+    if (strncasecmp(line, name, nameLen) == 0 && line[nameLen] == ':') {
+      const char* value = line + nameLen + 1;
+      while (*value == ' ') value++;
+      return value;
+    }
+    line = strstr(line, "\r\n");
+  }
+
+  return nullptr;
+}
+
+bool ExositeHTTP::parseHttpDate(const char* date, unsigned long* epoch) {
+  static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+  // e.g. "Sun, 18 Oct 2026 12:00:00 GMT"
+  int day, year, hour, minute, second;
+  char month[4];
+  if (sscanf(date, "%*3s, %d %3s %d %d:%d:%d", &day, month, &year, &hour, &minute, &second) != 6) {
+    return false;
+  }
+
+  const char* found = strstr(months, month);
+  if (!found || strlen(month) != 3 || (found - months) % 3 != 0 || year < 1970) {
+    return false;
+  }
+  int mon = (found - months) / 3 + 1;
+
+  // Days since epoch (civil calendar, with the year starting in March)
+  int y = year - (mon <= 2);
+  int era = y / 400;
+  int yoe = y - era * 400;
+  int doy = (153 * (mon + (mon > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  long days = (long)era * 146097 + doe - 719468;
+
+  *epoch = (unsigned long)days * 86400UL + hour * 3600UL + minute * 60UL + second;
+  return true;
+}
+
+void ExositeHTTP::clockAdvance() {
+  unsigned long elapsed = millis() - _clockRef;
+
+  // Re-base well before `millis() - _clockRef` could wrap
+  if (_clockValid && elapsed >= 0x40000000UL) {
+    _clockError = clockError();
+    _clockEpochMs += elapsed;
+    _clockRef += elapsed;
+  }
+}
+
+unsigned long ExositeHTTP::clockError() {
+  unsigned long elapsed = millis() - _clockRef;
+  return _clockError + (unsigned long)((uint64_t)elapsed * _clockDriftPpm / 1000000UL);
+}
+
+void ExositeHTTP::clockSample(unsigned long serverTime) {
+  clockAdvance();
+
+  unsigned long roundTrip = _firstByte - _requestStart;
+  unsigned long midpoint = _requestStart + roundTrip / 2;
+
+  // Server time is truncated to the second, so the sample is +/- 500 ms (plus half the round trip)
+  unsigned long sampleError = roundTrip / 2 + 500;
+
+  if (_clockValid) {
+    // Keep the current estimate if it is still more accurate (at the time of the sample)
+    unsigned long sinceRef = midpoint - _clockRef;
+    unsigned long currentError = _clockError + (unsigned long)((uint64_t)sinceRef * _clockDriftPpm / 1000000UL);
+    if (sinceRef < 0x80000000UL && currentError <= sampleError) {
+      return;
+    }
+  }
+
+  _clockValid = true;
+  _clockRef = midpoint;
+  _clockEpochMs = (uint64_t)serverTime * 1000 + 500;
+  _clockError = sampleError;
+}
+
+bool ExositeHTTP::sendGetRequest(const char* path, const char* resource, const char* clientAuth, const char* pollHeaders) {
+  _requestStart = millis();
+  _responded = false;
+
+  if (budgetExpired("send")) {
+    _client->stop();
+    return false;
+  }
+
+  _client->print(G("GET "));
+  _client->print(path);
+  if (resource) {
+    _client->print("?");
+    _client->print(resource);
+  }
+  _client->println(G(" HTTP/1.1"));
+
+  _client->print(G("Host: "));
+  _client->println(_connector);
+
+  _client->print(G("User-Agent: ExositeHTTP-Cpp/"));
+  _client->print(ACTIVATOR_VERSION);
+  _client->print(G(" Arduino/"));
+  _client->println(ARDUINO);
+
+  _client->println(G("Accept: application/x-www-form-urlencoded; charset=utf-8"));
+
+  if (_compress) {
+    _client->println(G("Accept-Encoding: deflate, gzip"));
+  }
+
+  if (clientAuth) {
+    // Add authorization header
+    _client->print(G("Authorization: token "));
+    _client->println(clientAuth);
+  }
+
+  if (pollHeaders) {
+    _client->println(pollHeaders);  // e.g. "If-Modified-Since: 0\r\nRequest-Timeout: 5000"
+  }
+
+  _client->println();  // End of headers
+  return true;
+}
+
+bool ExositeHTTP::sendPostRequest(const char* path, const char* key, size_t keyLen, const char* value, const char* clientAuth) {
+  _requestStart = millis();
+  _responded = false;
+
+  if (budgetExpired("send")) {
+    _client->stop();
+    return false;
+  }
+
+  _client->print(G("POST "));
+  _client->print(path);
+  _client->println(G(" HTTP/1.1"));
+
+  _client->print(G("Host: "));
+  _client->println(_connector);
+
+  _client->print(G("User-Agent: ExositeHTTP-Cpp/"));
+  _client->print(ACTIVATOR_VERSION);
+  _client->print(G(" Arduino/"));
+  _client->println(ARDUINO);
+
+  _client->println(G("Accept: application/x-www-form-urlencoded; charset=utf-8"));
+  _client->println(G("Content-Type: application/x-www-form-urlencoded; charset=utf-8"));
+
+  // Compute content length
+  size_t valueLen = value ? strlen(value) : 0;
+  size_t contentLength = keyLen + strlen("=") + valueLen;
+
+  bool compressed = _compress && contentLength >= _compressMin;
+  if (compressed) {
+    // First pass only measures the compressed length
+    ExositeDeflate measure(nullptr);
+    measure.literals((const uint8_t*)key, keyLen);
+    measure.literals((const uint8_t*)"=", 1);
+    measure.compress((const uint8_t*)value, valueLen);
+    contentLength = measure.finish();
+
+    _client->println(G("Accept-Encoding: deflate, gzip"));
+    _client->println(G("Content-Encoding: deflate"));
+  }
+  else if (_compress) {
+    _client->println(G("Accept-Encoding: deflate, gzip"));
+  }
+
+  _client->print(G("Content-Length: "));
+  _client->println(contentLength);
+
+  if (clientAuth) {
+    // Add authorization header
+    _client->print(G("Authorization: token "));
+    _client->println(clientAuth);
+  }
+  _client->println();  // End of headers
+
+  // Abort (rather than leave a partial request on the connection) once the budget is exhausted
+  if (budgetExpired("sending body")) {
+    _client->stop();
+    return false;
+  }
+
+  if (compressed) {
+    // Write compressed body (as key=value), streamed to the client
+    ExositeDeflate deflate(clientSink, _client);
+    deflate.literals((const uint8_t*)key, keyLen);
+    deflate.literals((const uint8_t*)"=", 1);
+    deflate.compress((const uint8_t*)value, valueLen);
+    deflate.finish();
+    return true;
+  }
+
+  // Write body (as key=value)
+  _client->write((const uint8_t*)key, keyLen);
+  _client->print("=");
+  _client->println(value);
+  return true;
+}
+
+ApiResponse ExositeHTTP::writeEncoded(const char* resource, size_t resourceLen) {
+  ApiResponse res;
+  res.statusCode = 0;
+  res.success = false;
+
+  if (!sendPostRequest("/onep:v1/stack/alias", resource, resourceLen, _dataBuffer, _clientToken)) {
+    return res;
+  }
+
+  // [Re]use the shared buffer to receive the HTTP response
+  if (!readHttpResponse(_dataBuffer, sizeof(_dataBuffer), _rxTimeout)) {
+    LOG_ERROR(G("Failed to fully parse HTTP response"));
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return res;
+  }
+
+  // Extract HTTP status code
+  int statusCode = 0;
+  if (sscanf(_dataBuffer, "HTTP/1.1 %d", &statusCode) != 1) {
+    LOG_ERROR(G("Could not parse HTTP status code"));
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return res;
+  }
+
+  res.statusCode = statusCode;
+
+  // Handle by HTTP status code
+  if (statusCode == 204) {
+    if (_rbeEnabled) {
+      rbeCommit();
+    }
+    res.success = true;
+    return res;
+  }
+  else {
+    LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
+    return res;
+  }
+}
+
+bool ExositeHTTP::appendChannel(const char* channel, const char* value, size_t valueLen) {
+  if (!channel || _channelOverflow) {
+    return false;
+  }
+
+  size_t channelLen = strlen(channel);
+
+  if (_rbeEnabled) {
+    rbeStageField(channel, channelLen, value, valueLen);
+  }
+
+  // Roll back a partially appended channel, so the payload remains valid JSON
+  size_t start = _channelLen;
+
+  if ((_channelCount == 0 || appendEncoded(",", 1)) &&
+      appendEncoded("\"", 1) &&
+      appendEncoded(channel, channelLen) &&
+      appendEncoded("\":", 2) &&
+      appendEncoded(value, valueLen)) {
+    _channelCount++;
+    return true;
+  }
+
+  LOG_ERROR(G("Channel payload larger than internal buffer (≥"), sizeof(_dataBuffer), G(" B)"));
+  _bufferStats.overflows++;
+  _channelLen = start;
+  _dataBuffer[_channelLen] = '\0';
+  _channelOverflow = true;
+  return false;
+}
+
+bool ExositeHTTP::appendEncoded(const char* src, size_t len) {
+  const size_t maxSize = sizeof(_dataBuffer) - 1;
+
+  for (size_t i = 0; i < len; i++) {
+    char encoded[3];
+    size_t encodedLen = encodeChar(src[i], encoded, _encoding);
+
+    if (_channelLen + encodedLen > maxSize) {
+      _dataBuffer[_channelLen] = '\0';
+      return false;
+    }
+
+    memcpy(_dataBuffer + _channelLen, encoded, encodedLen);
+    _channelLen += encodedLen;
+  }
+
+  _dataBuffer[_channelLen] = '\0';
+  return true;
+}
+
+// Two-digit decimal strings (`00` to `99`), to halve the number of divisions
+static const char DIGIT_PAIRS[] =
+  "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+static const uint32_t POWERS_OF_10[] = {
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+/**
+ * @brief Writes the decimal digits of a value in reverse order (least significant first)
+ *
+ * @return Number of digits written
+ */
+static size_t reverseDigits(uint64_t value, char* digits) {
+  size_t count = 0;
+
+  // Reduce to 32 bits, avoiding 64-bit division for the remaining digits
+  while (value > 0xFFFFFFFFULL) {
+    digits[count++] = '0' + (value % 10);
+    value /= 10;
+  }
+
+  uint32_t small = (uint32_t)value;
+  while (small >= 100) {
+    const char* pair = DIGIT_PAIRS + (small % 100) * 2;
+    small /= 100;
+    digits[count++] = pair[1];
+    digits[count++] = pair[0];
+  }
+
+  if (small >= 10) {
+    const char* pair = DIGIT_PAIRS + small * 2;
+    digits[count++] = pair[1];
+    digits[count++] = pair[0];
+  }
+  else {
+    digits[count++] = '0' + small;
+  }
+
+  return count;
+}
+
+/**
+ * @brief Writes a positive value in exponent notation, with up to 15 significant digits (e.g. `2.5e19`)
+ *
+ * @return Length of the formatted value
+ */
+static size_t formatExponent(double value, char* dest) {
+  // Normalize to a mantissa in [1, 10)
+  int exponent = (int)floor(log10(value));
+  double mantissa = value / pow(10, exponent);
+  if (mantissa >= 10) {
+    mantissa /= 10;
+    exponent++;
+  }
+  else if (mantissa < 1) {
+    mantissa *= 10;
+    exponent--;
+  }
+
+  // As many significant digits as a double reliably holds
+  uint64_t significand = (uint64_t)(mantissa * 1e14 + 0.5);
+  if (significand >= 1000000000000000ULL) {
+    significand /= 10; // Rounded up to 10
+    exponent++;
+  }
+
+  char digits[24];
+  size_t count = reverseDigits(significand, digits);
+
+  // Drop trailing zeros (least significant digits come first)
+  size_t first = 0;
+  while (first < count - 1 && digits[first] == '0') {
+    first++;
+  }
+
+  size_t pos = 0;
+  dest[pos++] = digits[--count];
+  if (count > first) {
+    dest[pos++] = '.';
+    while (count > first) {
+      dest[pos++] = digits[--count];
+    }
+  }
+
+  dest[pos++] = 'e';
+  count = reverseDigits(exponent, digits); // Always positive (values beyond 1.8e19)
+  while (count > 0) {
+    dest[pos++] = digits[--count];
+  }
+
+  dest[pos] = '\0';
+  return pos;
+}
+
+size_t ExositeHTTP::formatNumber(double value, unsigned int precision, char* dest, NumberFormat format) {
+  // JSON has no representation of NaN or infinity
+  if (isnan(value) || isinf(value)) {
+    memcpy(dest, "null", 5);
+    return 4;
+  }
+
+  if (precision > 9) {
+    precision = 9;
+  }
+
+  bool negative = (value < 0);
+  if (negative) {
+    value = -value;
+  }
+
+  // Values beyond 64 bits are written in exponent notation instead
+  if (value >= 1.8e19) {
+    size_t pos = 0;
+    if (negative) {
+      dest[pos++] = '-';
+    }
+    return pos + formatExponent(value, dest + pos);
+  }
+
+  // Scale to a rounded integer (reducing precision for large values, to fit in 64 bits)
+  while (precision > 0 && value * POWERS_OF_10[precision] >= 1e18) {
+    precision--;
+  }
+  double scaled = value * POWERS_OF_10[precision];
+
+  uint64_t rounded = (uint64_t)(scaled + 0.5);
+
+  char digits[24];
+  size_t count = reverseDigits(rounded, digits);
+
+  // Pad to at least one integer digit
+  while (count <= precision) {
+    digits[count++] = '0';
+  }
+
+  // Drop trailing zeros of the decimal places (least significant digits come first)
+  size_t first = 0;
+  if (format == NUMBER_FORMAT_SHORTEST) {
+    while (precision > 0 && digits[first] == '0') {
+      first++;
+      precision--;
+    }
+  }
+
+  size_t pos = 0;
+  if (negative && rounded) {
+    dest[pos++] = '-'; // Avoid emitting "-0"
+  }
+
+  // Digits are in reverse order, with the decimal point `precision` digits from the end
+  while (count > first) {
+    if (count - first == precision) {
+      dest[pos++] = '.';
+    }
+    dest[pos++] = digits[--count];
+  }
+
+  dest[pos] = '\0';
+  return pos;
+}
+
+size_t ExositeHTTP::formatInteger(long value, char* dest) {
+  unsigned long magnitude = (value < 0) ? 0UL - (unsigned long)value : (unsigned long)value;
+
+  char digits[24];
+  size_t count = reverseDigits(magnitude, digits);
+
+  size_t pos = 0;
+  if (value < 0) {
+    dest[pos++] = '-';
+  }
+  while (count > 0) {
+    dest[pos++] = digits[--count];
+  }
+
+  dest[pos] = '\0';
+  return pos;
+}
+
+void ExositeHTTP::buildPollHeaders(char* buffer, size_t bufferSize, unsigned long lastModified, unsigned long pollTimeoutMs) {
+  snprintf(buffer, bufferSize, "If-Modified-Since: %lu\r\nRequest-Timeout: %lu", lastModified, pollTimeoutMs);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void ExositeHTTP::setReadCache(ReadCacheEntry* entries, size_t count) {
+  _readCache = entries;
+  _readCacheCount = entries ? count : 0;
+}
+
+ReadCacheStats ExositeHTTP::getReadCacheStats() {
+  return _readCacheStats;
+}
+
+ReadCacheEntry* ExositeHTTP::cacheFind(const char* resource) {
+  if (!resource) {
+    return nullptr;
+  }
+
+  for (size_t i = 0; i < _readCacheCount; i++) {
+    if (_readCache[i].resource && strcmp(_readCache[i].resource, resource) == 0) {
+      // Counted as a miss until answered from the cache (see: `cacheHit()`)
+      _readCacheStats.misses++;
+      return &_readCache[i];
+    }
+  }
+  return nullptr;
+}
+
+const char* ExositeHTTP::cacheCondition(ReadCacheEntry* entry) {
+  if (!entry || !entry->valid) {
+    return nullptr;
+  }
+
+  snprintf(_pollHeaders, sizeof(_pollHeaders), "If-Modified-Since: %lu", entry->lastModified);
+  return _pollHeaders;
+}
+
+void ExositeHTTP::cacheStore(ReadCacheEntry* entry, const char* value) {
+  if (!entry) {
+    return;
+  }
+
+  entry->valid = false;
+
+  // Time of the value (falling back to the response date, as the value is at least as old)
+  unsigned long modified = 0;
+  const char* header = findHeader(_dataBuffer, "Last-Modified");
+  if (!header || !parseHttpDate(header, &modified)) {
+    modified = header ? strtoul(header, nullptr, 10) : 0;
+  }
+  header = findHeader(_dataBuffer, "Date");
+  if (!modified && header) {
+    parseHttpDate(header, &modified);
+  }
+
+  size_t length = strlen(value);
+  if (!modified || length >= entry->bufferSize) {
+    return; // Cannot be revalidated (or does not fit)
+  }
+
+  memcpy(entry->buffer, value, length + 1);
+  entry->lastModified = modified;
+  entry->valid = true;
+}
+
+const char* ExositeHTTP::cacheHit(ReadCacheEntry* entry) {
+  if (!entry || !entry->valid) {
+    LOG_ERROR(G("Unexpected HTTP status: "), 304);
+    return nullptr;
+  }
+
+  _readCacheStats.misses--; // Counted by `cacheFind()`
+  _readCacheStats.hits++;
+  _readCacheStats.bytesSaved += strlen(entry->buffer);
+  return entry->buffer;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+ResourceHandle ExositeHTTP::registerResource(const char* resource, ReadHandler handler) {
+  ResourceHandle handle = findResource(resource);
+  if (handle >= 0) {
+    _resources[handle].handler = handler;
+    return handle;
+  }
+
+  if (!resource || _resourceCount >= EXO_MAX_RESOURCES || strlen(resource) >= EXO_RESOURCE_NAME_SIZE) {
+    LOG_ERROR(G("Cannot register resource: "), resource ? resource : "");
+    return -1;
+  }
+
+  // Aliases are always strictly encoded (regardless of the body encoding profile)
+  ResourceEntry& entry = _resources[_resourceCount];
+  if (!urlEncode(resource, entry.encoded, sizeof(entry.encoded), URL_ENCODING_STRICT)) {
+    LOG_ERROR(G("Cannot register resource: "), resource);
+    return -1;
+  }
+
+  strcpy(entry.alias, resource);
+  entry.encodedLen = strlen(entry.encoded);
+  entry.hash = fnv1a(_fnvOffset, resource, strlen(resource));
+  entry.handler = handler;
+
+  return _resourceCount++;
+}
+
+ResourceHandle ExositeHTTP::findResource(const char* resource) {
+  if (!resource) {
+    return -1;
+  }
+
+  uint32_t hash = fnv1a(_fnvOffset, resource, strlen(resource));
+  for (unsigned int i = 0; i < _resourceCount; i++) {
+    if (_resources[i].hash == hash && strcmp(_resources[i].alias, resource) == 0) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+const char* ExositeHTTP::resourceName(ResourceHandle handle) {
+  const ResourceEntry* entry = resourceEntry(handle);
+  return entry ? entry->alias : nullptr;
+}
+
+const ExositeHTTP::ResourceEntry* ExositeHTTP::resourceEntry(ResourceHandle handle) {
+  if (handle < 0 || (unsigned int)handle >= _resourceCount) {
+    LOG_ERROR(G("Invalid resource handle: "), (int)handle);
+    return nullptr;
+  }
+  return &_resources[handle];
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+ApiResponse ExositeHTTP::provision(const char* identity, char* responseBuffer, size_t bufferSize) {
+  ApiResponse res;
+  res.statusCode = 0;
+  res.success = false;
+
+  responseBuffer[0] = '\0'; // Ensure the provided response buffer is cleared for use
+
+  if (!isConnected()) {
+    LOG_ERROR(G("Failed to connect to server"));
+    return res;
+  }
+
+  if (!identity || !responseBuffer || bufferSize < 41) {
+    LOG_ERROR(G("Invalid arguments for provisioning"));
+    return res;
+  }
+
+  if (!sendPostRequest("/provision/activate", "id", 2, identity, nullptr)) {
+    return res;
+  }
+
+  // Use the shared buffer to receive the HTTP response
+  if (!readHttpResponse(_dataBuffer, sizeof(_dataBuffer), _rxTimeout)) {
+    LOG_ERROR(G("Failed to fully parse HTTP response"));
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return res;
+  }
+
+  // Extract HTTP status code
+  int statusCode = 0;
+  if (sscanf(_dataBuffer, "HTTP/1.1 %d", &statusCode) != 1) {
+    LOG_ERROR(G("Could not parse HTTP status code"));
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return res;
+  }
+
+  res.statusCode = statusCode;
+
+  // Handle by HTTP status code
+  if (statusCode == 200) {
+    const char* body = strstr(_dataBuffer, "\r\n\r\n"); // Assume body starts after double CRLF
+    if (!body) {
+      LOG_ERROR(G("Malformed HTTP response"));
+      LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+      return res;
+    }
+    else {
+      body += 4; // Skip past double CRLF ("\r\n\r\n")
+      res.success = urlDecode(body, responseBuffer, bufferSize);
+      return res;
+    }
+  }
+  else if (statusCode == 409) {
+    LOG_ERROR(G("Identity is already provisioned (409 Conflict)"));
+    return res;
+  }
+  else {
+    LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
+    return res;
+  }
+}
+
+#ifndef EXO_NO_HEAP
+ApiResponse ExositeHTTP::provision(const String& identity, String& responseString) {
+  ApiResponse res;
+  res.statusCode = 0;
+  res.success = false;
+
+  responseString = ""; // Ensure the provided response String is cleared for use
+
+  if (!isConnected()) {
+    LOG_ERROR(G("Failed to connect to server"));
+    return res;
+  }
+
+  if (identity.length() == 0) {
+    LOG_ERROR(G("Cannot provision provided identity: "), identity);
+    return res;
+  }
+
+  if (!sendPostRequest("/provision/activate", "id", 2, identity.c_str(), nullptr)) {
+    return res;
+  }
+
+  // Use the shared buffer to receive the HTTP response
+  if (!readHttpResponse(_dataBuffer, sizeof(_dataBuffer), _rxTimeout)) {
+    LOG_ERROR(G("Failed to fully parse HTTP response"));
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return res;
+  }
+
+  // Extract HTTP status code
+  int statusCode = 0;
+  if (sscanf(_dataBuffer, "HTTP/1.1 %d", &statusCode) != 1) {
+    LOG_ERROR(G("Could not parse HTTP status code"));
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return res;
+  }
+
+  res.statusCode = statusCode;
+
+  // Handle by HTTP status code
+  if (statusCode == 200) {
+    const char* body = strstr(_dataBuffer, "\r\n\r\n"); // Assume body starts after double CRLF
+    if (!body) {
+      LOG_ERROR(G("Malformed HTTP response"));
+      LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+      return res;
+    }
+    else {
+      body += 4; // Skip past double CRLF ("\r\n\r\n")
+      res.success = urlDecode(String(body), responseString);
+      return res;
+    }
+  }
+  else if (statusCode == 409) {
+    LOG_ERROR(G("Identity is already provisioned (409 Conflict)"));
+    return res;
+  }
+  else {
+    LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return res;
+  }
+}
+#endif
+
+ApiResponse ExositeHTTP::write(const char* resource, const char* writeChars) {
+  return writeAlias(resource, resource, resource ? strlen(resource) : 0, writeChars);
+}
+
+ApiResponse ExositeHTTP::writeAlias(const char* alias, const char* resource, size_t resourceLen, const char* writeChars) {
+  ApiResponse res;
+  res.statusCode = 0;
+  res.success = false;
+
+  // Skip unchanged values (before any connection attempt)
+  if (_rbeEnabled && resource && writeChars) {
+    rbeStageValue(writeChars);
+    if (!rbeShouldSend(alias)) {
+      LOG_DEBUG(G("Write suppressed (unchanged): "), alias);
+      _responded = false;
+      res.statusCode = 304;
+      res.success = true;
+      return res;
+    }
+  }
+
+  if (!isConnected()) {
+    LOG_ERROR(G("Failed to connect to server"));
+    return res;
+  }
+
+  if (!resource || !writeChars) {
+    LOG_ERROR(G("Missing value for resource and/or writeChars"));
+    return res;
+  }
+
+  // Use the shared buffer to hold encoded request payload
+  if (urlEncode(writeChars, _dataBuffer, sizeof(_dataBuffer), _encoding)) {
+    return writeEncoded(resource, resourceLen);
+  }
+  else {
+    return res; // Failed to encode provided writeChars
+  }
+}
+
+ApiResponse ExositeHTTP::write(const String& resource, const String& writeString) {
+  return write(resource.c_str(), writeString.c_str());
+}
+
+ApiResponse ExositeHTTP::write(ResourceHandle handle, const char* writeChars) {
+  const ResourceEntry* entry = resourceEntry(handle);
+  if (!entry) {
+    ApiResponse res;
+    res.statusCode = 0;
+    res.success = false;
+    return res;
+  }
+
+  return writeAlias(entry->alias, entry->encoded, entry->encodedLen, writeChars);
+}
+
+void ExositeHTTP::beginChannels() {
+  _channelLen = 0;
+  _channelCount = 0;
+  _channelOverflow = false;
+  _dataBuffer[0] = '\0';
+
+  if (_rbeEnabled) {
+    // Stage the channels for report-by-exception as they are added
+    _rbeValueHash = _fnvOffset;
+    for (unsigned int i = 0; i < _rbeChannelCount; i++) {
+      _rbeChannels[i].hasPending = false;
+    }
+  }
+
+  appendEncoded("{", 1);
+}
+
+bool ExositeHTTP::addChannel(const char* channel, bool value) {
+  return value ? appendChannel(channel, "true", 4) : appendChannel(channel, "false", 5);
+}
+
+bool ExositeHTTP::addChannel(const char* channel, int value) {
+  return addChannel(channel, (long)value);
+}
+
+bool ExositeHTTP::addChannel(const char* channel, long value) {
+  char number[24];
+  size_t len = formatInteger(value, number);
+  return appendChannel(channel, number, len);
+}
+
+bool ExositeHTTP::addChannel(const char* channel, double value, unsigned int precision, NumberFormat format) {
+  char number[32];
+  size_t len = formatNumber(value, precision, number, format);
+  return appendChannel(channel, number, len);
+}
+
+ApiResponse ExositeHTTP::writeChannels(const char* resource) {
+  return writeChannelsAlias(resource, resource, resource ? strlen(resource) : 0);
+}
+
+ApiResponse ExositeHTTP::writeChannelsAlias(const char* alias, const char* resource, size_t resourceLen) {
+  ApiResponse res;
+  res.statusCode = 0;
+  res.success = false;
+
+  if (!resource || _channelOverflow || !appendEncoded("}", 1)) {
+    LOG_ERROR(G("Channel payload larger than internal buffer (≥"), sizeof(_dataBuffer), G(" B)"));
+    return res;
+  }
+
+  trackUsage(_bufferStats.encodedHighWater, _channelLen, sizeof(_dataBuffer) - 1);
+
+  if (_rbeEnabled && !rbeShouldSend(alias)) {
+    LOG_DEBUG(G("Write suppressed (unchanged): "), alias);
+    _responded = false;
+    res.statusCode = 304;
+    res.success = true;
+    return res;
+  }
+
+  if (!isConnected()) {
+    LOG_ERROR(G("Failed to connect to server"));
+    return res;
+  }
+
+  return writeEncoded(resource, resourceLen);
+}
+
+ApiResponse ExositeHTTP::writeChannels(ResourceHandle handle) {
+  const ResourceEntry* entry = resourceEntry(handle);
+  if (!entry) {
+    ApiResponse res;
+    res.statusCode = 0;
+    res.success = false;
+    return res;
+  }
+
+  return writeChannelsAlias(entry->alias, entry->encoded, entry->encodedLen);
+}
+
+ApiResponse ExositeHTTP::read(const char* resource, char* responseBuffer, size_t bufferSize) {
+  return readAlias(resource, resource, responseBuffer, bufferSize);
+}
+
+ApiResponse ExositeHTTP::readAlias(const char* alias, const char* resource, char* responseBuffer, size_t bufferSize) {
+  ApiResponse res;
+  res.statusCode = 0;
+  res.success = false;
+
+  responseBuffer[0] = '\0'; // Ensure the provided response buffer is cleared for use
+
+  ReadCacheEntry* cached = cacheFind(alias);
+
+  if (!isConnected()) {
+    LOG_ERROR(G("Failed to connect to server"));
+    return res;
+  }
+
+  if (!sendGetRequest("/onep:v1/stack/alias", resource, _clientToken, cacheCondition(cached))) {
+    return res;
+  }
+
+  // Use the shared buffer to receive the HTTP response
+  if (!readHttpResponse(_dataBuffer, sizeof(_dataBuffer), _rxTimeout)) {
+    LOG_ERROR(G("Failed to fully parse HTTP response"));
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return res;
+  }
+
+  // Extract HTTP status code
+  int statusCode = 0;
+  if (sscanf(_dataBuffer, "HTTP/1.1 %d", &statusCode) != 1) {
+    LOG_ERROR(G("Could not parse HTTP status code"));
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return res;
+  }
+
+  res.statusCode = statusCode;
+
+  // Handle by HTTP status code
+  if (statusCode == 200) {
+    char* body = strstr(_dataBuffer, "\r\n\r\n"); // Assume body starts after double CRLF
+    if (!body) {
+      LOG_ERROR(G("Malformed HTTP response"));
+      LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+      return res;
+    }
+    else {
+      body += 4; // Skip past double CRLF ("\r\n\r\n")
+
+      // Confirm the response body matches the expected structure
+      const char* delimiter = strchr(body, '=');
+      if (!delimiter || *(delimiter + 1) == '\0') {
+        LOG_ERROR(G("Malformed response body (not 'resource=value')"));
+        LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+        return res;
+      }
 
-  // Write body (as key=value)
-  _client->print(key);
-  _client->print("=");
-  _client->println(value);
-}
+      const char* value = delimiter + 1; // Skip past the delimiter, to just the value
 
-void ExositeHTTP::buildPollHeaders(char* buffer, size_t bufferSize, unsigned long lastModified, unsigned long pollTimeoutMs) {
-  snprintf(buffer, bufferSize, "If-Modified-Since: %lu\r\nRequest-Timeout: %lu", lastModified, pollTimeoutMs);
-}
+      res.success = urlDecode(value, responseBuffer, bufferSize);
+      if (res.success) {
+        cacheStore(cached, responseBuffer);
+        rbeForget(alias);
+      }
+      return res;
+    }
+  }
+  else if (statusCode == 204) {
+    if (cached) {
+      cached->valid = false;
+    }
+    res.success = true;
+    return res;
+  }
+  else if (statusCode == 304) {
+    // Unchanged since the cached value (see: `setReadCache()`)
+    const char* value = cacheHit(cached);
+    if (!value) {
+      return res;
+    }
+    if (strlen(value) >= bufferSize) {
+      LOG_ERROR(G("Decoded response body larger than provided buffer (≥"), bufferSize, G(" B)"));
+      return res;
+    }
+    strcpy(responseBuffer, value);
+    res.success = true;
+    return res;
+  }
 
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
+  return res;
+}
 
-ApiResponse ExositeHTTP::provision(const char* identity, char* responseBuffer, size_t bufferSize) {
+ApiResponse ExositeHTTP::readStream(const char* resource, ValueSink sink, void* context) {
   ApiResponse res;
   res.statusCode = 0;
   res.success = false;
 
-  responseBuffer[0] = '\0'; // Ensure the provided response buffer is cleared for use
-
   if (!isConnected()) {
     LOG_ERROR(G("Failed to connect to server"));
     return res;
   }
 
-  if (!identity || !responseBuffer || bufferSize < 41) {
-    LOG_ERROR(G("Invalid arguments for provisioning"));
+  // The value is decoded as it arrives, so the response cannot be compressed
+  bool compress = _compress;
+  _compress = false;
+  bool sent = sendGetRequest("/onep:v1/stack/alias", resource, _clientToken, nullptr);
+  _compress = compress;
+  if (!sent) {
     return res;
   }
 
-  sendPostRequest("/provision/activate", "id", identity, nullptr);
+  unsigned long startTime = millis();
+  unsigned long timeoutMs = _rxTimeout;
 
-  // Use the shared buffer to receive the HTTP response
-  if (!readHttpResponse(_dataBuffer, sizeof(_dataBuffer), _rxTimeout)) {
-    LOG_ERROR(G("Failed to fully parse HTTP response"));
-    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
-    return res;
+  // Bound the timeout by the remaining time budget (see: `setRequestBudget()`)
+  unsigned long remaining = budgetRemaining();
+  if (remaining < timeoutMs) {
+    timeoutMs = remaining;
   }
 
-  // Extract HTTP status code
+  // Read the headers into the shared buffer
+  const size_t maxSize = sizeof(_dataBuffer) - 1;
+  size_t pos = 0;
+
+  while (pos < 4 || memcmp(_dataBuffer + pos - 4, "\r\n\r\n", 4) != 0) {
+    int c = readResponseByte(startTime, timeoutMs);
+    if (c < 0) {
+      _client->stop(); // Timed out or cut short, the rest cannot be consumed
+      return res;
+    }
+    else if (pos >= maxSize) {
+      LOG_ERROR(G("Response headers are larger than internal buffer allocation (≥"), sizeof(_dataBuffer), G(" B)"));
+      _bufferStats.overflows++;
+      _client->stop();
+      return res;
+    }
+    _dataBuffer[pos++] = c;
+  }
+  _dataBuffer[pos] = '\0';
+
+  trackResponse(_dataBuffer, sizeof(_dataBuffer), pos);
+  clockSampleDate(_dataBuffer);
+
   int statusCode = 0;
   if (sscanf(_dataBuffer, "HTTP/1.1 %d", &statusCode) != 1) {
     LOG_ERROR(G("Could not parse HTTP status code"));
     LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    _client->stop();
     return res;
   }
 
   res.statusCode = statusCode;
 
-  // Handle by HTTP status code
-  if (statusCode == 200) {
-    const char* body = strstr(_dataBuffer, "\r\n\r\n"); // Assume body starts after double CRLF
-    if (!body) {
-      LOG_ERROR(G("Malformed HTTP response"));
-      LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+  if (statusCode == 204) {
+    res.success = true;
+    return res;
+  }
+
+  const char* length = findHeader(_dataBuffer, "Content-Length");
+  if (!length) {
+    LOG_ERROR(G("Response has no Content-Length"));
+    _client->stop();
+    return res;
+  }
+  size_t contentLength = strtoul(length, nullptr, 10);
+
+  if (statusCode != 200) {
+    LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
+    _client->stop();
+    return res;
+  }
+
+  // Decode the body (`resource=value`) as it arrives, passing on the value in buffer-sized parts
+  bool inValue = false;
+  uint8_t escapeDigits = 0; // Hex digits remaining of a `%XX` escape
+  char escaped = 0;
+  pos = 0;
+
+  for (size_t i = 0; i < contentLength; i++) {
+    int c = readResponseByte(startTime, timeoutMs);
+    if (c < 0) {
+      _client->stop(); // Timed out or cut short, the rest cannot be consumed
       return res;
     }
-    else {
-      body += 4; // Skip past double CRLF ("\r\n\r\n")
-      res.success = urlDecode(body, responseBuffer, bufferSize);
-      return res;
+
+    if (!inValue) {
+      inValue = c == '='; // Skip past the delimiter, to just the value
+      continue;
+    }
+
+    if (escapeDigits) {
+      if (c >= '0' && c <= '9') c = c - '0';
+      else if (c >= 'A' && c <= 'F') c = c - 'A' + 10;
+      else if (c >= 'a' && c <= 'f') c = c - 'a' + 10;
+      else {
+        LOG_ERROR(G("Invalid hex in response body"));
+        _client->stop();
+        return res;
+      }
+
+      escaped = (escaped << 4) | c;
+      if (--escapeDigits) {
+        continue;
+      }
+      c = escaped;
+    }
+    else if (c == '%') {
+      escapeDigits = 2;
+      escaped = 0;
+      continue;
+    }
+    else if (c == '+') {
+      c = ' '; // Plus sign is replaced by a space
+    }
+
+    _dataBuffer[pos++] = c;
+    if (pos == maxSize) {
+      sink(_dataBuffer, pos, context);
+      pos = 0;
     }
   }
-  else if (statusCode == 409) {
-    LOG_ERROR(G("Identity is already provisioned (409 Conflict)"));
+
+  if (!inValue || escapeDigits) {
+    LOG_ERROR(G("Malformed response body (not 'resource=value')"));
+    _client->stop();
     return res;
   }
-  else {
-    LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
-    return res;
+
+  if (pos > 0) {
+    sink(_dataBuffer, pos, context);
   }
+
+  rbeForget(resource);
+  res.success = true;
+  return res;
 }
 
-ApiResponse ExositeHTTP::provision(const String& identity, String& responseString) {
+ApiResponse ExositeHTTP::read(const char* resource, ValueView& value) {
   ApiResponse res;
   res.statusCode = 0;
   res.success = false;
 
-  responseString = ""; // Ensure the provided response String is cleared for use
+  value.data = "";
+  value.length = 0;
+
+  ReadCacheEntry* cached = cacheFind(resource);
 
   if (!isConnected()) {
     LOG_ERROR(G("Failed to connect to server"));
     return res;
   }
 
-  if (identity.length() == 0) {
-    LOG_ERROR(G("Cannot provision provided identity: "), identity);
+  if (!sendGetRequest("/onep:v1/stack/alias", resource, _clientToken, cacheCondition(cached))) {
     return res;
   }
 
-  sendPostRequest("/provision/activate", "id", identity.c_str(), nullptr);
-
   // Use the shared buffer to receive the HTTP response
   if (!readHttpResponse(_dataBuffer, sizeof(_dataBuffer), _rxTimeout)) {
     LOG_ERROR(G("Failed to fully parse HTTP response"));
@@ -313,97 +1936,142 @@ ApiResponse ExositeHTTP::provision(const String& identity, String& responseStrin
 
   // Handle by HTTP status code
   if (statusCode == 200) {
-    const char* body = strstr(_dataBuffer, "\r\n\r\n"); // Assume body starts after double CRLF
-    if (!body) {
-      LOG_ERROR(G("Malformed HTTP response"));
-      LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
-      return res;
-    }
-    else {
-      body += 4; // Skip past double CRLF ("\r\n\r\n")
-      res.success = urlDecode(String(body), responseString);
-      return res;
+    res.success = decodeBodyInPlace(value);
+    if (res.success) {
+      cacheStore(cached, value.data);
+      rbeForget(resource);
     }
+    return res;
   }
-  else if (statusCode == 409) {
-    LOG_ERROR(G("Identity is already provisioned (409 Conflict)"));
+  else if (statusCode == 204) {
+    if (cached) {
+      cached->valid = false;
+    }
+    res.success = true;
     return res;
   }
-  else {
-    LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
-    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+  else if (statusCode == 304) {
+    // Unchanged since the cached value (see: `setReadCache()`), viewed in the cache buffer
+    const char* data = cacheHit(cached);
+    if (data) {
+      value.data = data;
+      value.length = strlen(data);
+      res.success = true;
+    }
     return res;
   }
+
+  LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
+  return res;
 }
 
-ApiResponse ExositeHTTP::write(const char* resource, const char* writeChars) {
-  ApiResponse res;
-  res.statusCode = 0;
-  res.success = false;
+ApiResponse ExositeHTTP::readInt(const char* resource, long& value) {
+  ValueView view;
+  ApiResponse res = read(resource, view);
 
-  if (!isConnected()) {
-    LOG_ERROR(G("Failed to connect to server"));
-    return res;
-  }
+  if (res.success && view.length > 0) {
+    char* end;
+    errno = 0;
+    long parsed = strtol(view.data, &end, 10);
 
-  if (!resource || !writeChars) {
-    LOG_ERROR(G("Missing value for resource and/or writeChars"));
-    return res;
+    if (end != view.data + view.length) {
+      LOG_ERROR(G("Value is not an integer: "), view.data);
+      res.success = false;
+    }
+    else if (errno == ERANGE) {
+      LOG_ERROR(G("Integer value out of range: "), view.data);
+      res.success = false;
+    }
+    else {
+      value = parsed;
+    }
   }
 
-  // Use the shared buffer to hold encoded request payload
-  if (urlEncode(writeChars, _dataBuffer, sizeof(_dataBuffer))) {
-    sendPostRequest("/onep:v1/stack/alias", resource, _dataBuffer, _clientToken);
+  return res;
+}
 
-    // [Re]use the shared buffer to receive the HTTP response
-    if (!readHttpResponse(_dataBuffer, sizeof(_dataBuffer), _rxTimeout)) {
-      LOG_ERROR(G("Failed to fully parse HTTP response"));
-      LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
-      return res;
-    }
+ApiResponse ExositeHTTP::readFloat(const char* resource, float& value) {
+  ValueView view;
+  ApiResponse res = read(resource, view);
 
-    // Extract HTTP status code
-    int statusCode = 0;
-    if (sscanf(_dataBuffer, "HTTP/1.1 %d", &statusCode) != 1) {
-      LOG_ERROR(G("Could not parse HTTP status code"));
-      LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
-      return res;
+  if (res.success && view.length > 0) {
+    char* end;
+    double parsed = strtod(view.data, &end);
+
+    if (end != view.data + view.length || parsed != parsed) {
+      LOG_ERROR(G("Value is not a number: "), view.data);
+      res.success = false;
+    }
+    else if (parsed > FLT_MAX || parsed < -FLT_MAX) {
+      LOG_ERROR(G("Number value out of range: "), view.data);
+      res.success = false;
+    }
+    else {
+      value = parsed;
     }
+  }
+
+  return res;
+}
 
-    res.statusCode = statusCode;
+ApiResponse ExositeHTTP::readBool(const char* resource, bool& value) {
+  ValueView view;
+  ApiResponse res = read(resource, view);
 
-    // Handle by HTTP status code
-    if (statusCode == 204) {
-      res.success = true;
-      return res;
+  if (res.success && view.length > 0) {
+    if (strcmp(view.data, "1") == 0 || strcasecmp(view.data, "true") == 0 || strcasecmp(view.data, "on") == 0) {
+      value = true;
+    }
+    else if (strcmp(view.data, "0") == 0 || strcasecmp(view.data, "false") == 0 || strcasecmp(view.data, "off") == 0) {
+      value = false;
     }
     else {
-      LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
-      return res;
+      LOG_ERROR(G("Value is not a boolean: "), view.data);
+      res.success = false;
     }
   }
-  else {
-    return res; // Failed to encode provided writeChars
-  }
+
+  return res;
 }
 
-ApiResponse ExositeHTTP::write(const String& resource, const String& writeString) {
-  return write(resource.c_str(), writeString.c_str());
+ApiResponse ExositeHTTP::read(ResourceHandle handle, char* responseBuffer, size_t bufferSize) {
+  const ResourceEntry* entry = resourceEntry(handle);
+  if (!entry) {
+    ApiResponse res;
+    res.statusCode = 0;
+    res.success = false;
+    responseBuffer[0] = '\0';
+    return res;
+  }
+
+  ApiResponse res = readAlias(entry->alias, entry->encoded, responseBuffer, bufferSize);
+
+  // Dispatch the received value to the handler of the resource
+  if (res.success && res.statusCode == 200 && entry->handler) {
+    entry->handler(entry->alias, responseBuffer);
+  }
+
+  return res;
 }
 
-ApiResponse ExositeHTTP::read(const char* resource, char* responseBuffer, size_t bufferSize) {
+#ifndef EXO_NO_HEAP
+ApiResponse ExositeHTTP::read(const String& resource, String& responseString) {
   ApiResponse res;
   res.statusCode = 0;
   res.success = false;
 
-  responseBuffer[0] = '\0'; // Ensure the provided response buffer is cleared for use
+  responseString = ""; // Ensure the provided response String is cleared for use
+
+  ReadCacheEntry* cached = cacheFind(resource.c_str());
 
   if (!isConnected()) {
     LOG_ERROR(G("Failed to connect to server"));
     return res;
   }
 
-  sendGetRequest("/onep:v1/stack/alias", resource, _clientToken, nullptr);
+  if (!sendGetRequest("/onep:v1/stack/alias", resource.c_str(), _clientToken, cacheCondition(cached))) {
+    return res;
+  }
 
   // Use the shared buffer to receive the HTTP response
   if (!readHttpResponse(_dataBuffer, sizeof(_dataBuffer), _rxTimeout)) {
@@ -442,36 +2110,65 @@ ApiResponse ExositeHTTP::read(const char* resource, char* responseBuffer, size_t
       }
 
       const char* value = delimiter + 1; // Skip past the delimiter, to just the value
-
-      res.success = urlDecode(value, responseBuffer, bufferSize);
+      res.success = urlDecode(value, responseString);
+      if (res.success) {
+        cacheStore(cached, responseString.c_str());
+        rbeForget(resource.c_str());
+      }
       return res;
     }
   }
   else if (statusCode == 204) {
+    if (cached) {
+      cached->valid = false;
+    }
     res.success = true;
     return res;
   }
+  else if (statusCode == 304) {
+    // Unchanged since the cached value (see: `setReadCache()`)
+    const char* value = cacheHit(cached);
+    if (value) {
+      responseString = value;
+      res.success = true;
+    }
+    return res;
+  }
+  else {
+    LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
+    return res;
+  }
+}
+#endif
 
-  LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
-  return res;
+ApiResponse ExositeHTTP::longPoll(const char* resource, char* responseBuffer, size_t bufferSize, unsigned long lastModified, unsigned long pollTimeout) {
+  return longPollAlias(resource, resource, responseBuffer, bufferSize, lastModified, pollTimeout);
 }
 
-ApiResponse ExositeHTTP::read(const String& resource, String& responseString) {
+ApiResponse ExositeHTTP::longPollAlias(const char* alias, const char* resource, char* responseBuffer, size_t bufferSize, unsigned long lastModified, unsigned long pollTimeout) {
   ApiResponse res;
   res.statusCode = 0;
   res.success = false;
 
-  responseString = ""; // Ensure the provided response String is cleared for use
+  responseBuffer[0] = '\0'; // Ensure the provided response buffer is cleared for use
+
+  buildPollHeaders(_pollHeaders, sizeof(_pollHeaders), lastModified, pollTimeout);
 
   if (!isConnected()) {
     LOG_ERROR(G("Failed to connect to server"));
     return res;
   }
 
-  sendGetRequest("/onep:v1/stack/alias", resource.c_str(), _clientToken, nullptr);
+  if (!sendGetRequest("/onep:v1/stack/alias", resource, _clientToken, _pollHeaders)) {
+    return res;
+  }
+
+  // For longPoll() only, adjust the receive timeout to ensure complete processing of the request
+  unsigned long effectiveTimeout = _rxTimeout + pollTimeout;
+  _deadlineExtra = pollTimeout;
 
   // Use the shared buffer to receive the HTTP response
-  if (!readHttpResponse(_dataBuffer, sizeof(_dataBuffer), _rxTimeout)) {
+  if (!readHttpResponse(_dataBuffer, sizeof(_dataBuffer), effectiveTimeout)) {
     LOG_ERROR(G("Failed to fully parse HTTP response"));
     LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
     return res;
@@ -488,11 +2185,14 @@ ApiResponse ExositeHTTP::read(const String& resource, String& responseString) {
   res.statusCode = statusCode;
 
   // Handle by HTTP status code
-  if (statusCode == 200) {
+  if (statusCode == 304) {
+    res.success = true;
+    return res;
+  }
+  else if (statusCode == 200) {
     char* body = strstr(_dataBuffer, "\r\n\r\n"); // Assume body starts after double CRLF
     if (!body) {
-      LOG_ERROR(G("Malformed HTTP response"));
-      LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+      LOG_ERROR(G("Malformed response body"));
       return res;
     }
     else {
@@ -502,31 +2202,109 @@ ApiResponse ExositeHTTP::read(const String& resource, String& responseString) {
       const char* delimiter = strchr(body, '=');
       if (!delimiter || *(delimiter + 1) == '\0') {
         LOG_ERROR(G("Malformed response body (not 'resource=value')"));
-        LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
         return res;
       }
 
-      const char* value = delimiter + 1; // Skip past the delimiter, to just the value
-      res.success = urlDecode(value, responseString);
-      return res;
-    }
+      const char* value = delimiter + 1; // Skip past the delimiter, to just the value
+
+      res.success = urlDecode(value, responseBuffer, bufferSize);
+      if (res.success) {
+        rbeForget(alias);
+      }
+      return res;
+    }
+  }
+  else {
+    LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
+    return res;
+  }
+}
+
+ApiResponse ExositeHTTP::longPoll(const char* resource, ValueView& value, unsigned long lastModified, unsigned long pollTimeout) {
+  ApiResponse res;
+  res.statusCode = 0;
+  res.success = false;
+
+  value.data = "";
+  value.length = 0;
+
+  buildPollHeaders(_pollHeaders, sizeof(_pollHeaders), lastModified, pollTimeout);
+
+  if (!isConnected()) {
+    LOG_ERROR(G("Failed to connect to server"));
+    return res;
+  }
+
+  if (!sendGetRequest("/onep:v1/stack/alias", resource, _clientToken, _pollHeaders)) {
+    return res;
+  }
+
+  // For longPoll() only, adjust the receive timeout to ensure complete processing of the request
+  unsigned long effectiveTimeout = _rxTimeout + pollTimeout;
+  _deadlineExtra = pollTimeout;
+
+  // Use the shared buffer to receive the HTTP response
+  if (!readHttpResponse(_dataBuffer, sizeof(_dataBuffer), effectiveTimeout)) {
+    LOG_ERROR(G("Failed to fully parse HTTP response"));
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return res;
   }
-  else if (statusCode == 204) {
+
+  // Extract HTTP status code
+  int statusCode = 0;
+  if (sscanf(_dataBuffer, "HTTP/1.1 %d", &statusCode) != 1) {
+    LOG_ERROR(G("Could not parse HTTP status code"));
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return res;
+  }
+
+  res.statusCode = statusCode;
+
+  // Handle by HTTP status code
+  if (statusCode == 304) {
     res.success = true;
     return res;
   }
+  else if (statusCode == 200) {
+    res.success = decodeBodyInPlace(value);
+    if (res.success) {
+      rbeForget(resource);
+    }
+    return res;
+  }
   else {
     LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
     return res;
   }
 }
 
-ApiResponse ExositeHTTP::longPoll(const char* resource, char* responseBuffer, size_t bufferSize, unsigned long lastModified, unsigned long pollTimeout) {
+ApiResponse ExositeHTTP::longPoll(ResourceHandle handle, char* responseBuffer, size_t bufferSize, unsigned long lastModified, unsigned long pollTimeout) {
+  const ResourceEntry* entry = resourceEntry(handle);
+  if (!entry) {
+    ApiResponse res;
+    res.statusCode = 0;
+    res.success = false;
+    responseBuffer[0] = '\0';
+    return res;
+  }
+
+  ApiResponse res = longPollAlias(entry->alias, entry->encoded, responseBuffer, bufferSize, lastModified, pollTimeout);
+
+  // Dispatch the received value to the handler of the resource
+  if (res.success && res.statusCode == 200 && entry->handler) {
+    entry->handler(entry->alias, responseBuffer);
+  }
+
+  return res;
+}
+
+#ifndef EXO_NO_HEAP
+ApiResponse ExositeHTTP::longPoll(const String& resource, String& responseString, unsigned long lastModified, unsigned long pollTimeout) {
   ApiResponse res;
   res.statusCode = 0;
   res.success = false;
 
-  responseBuffer[0] = '\0'; // Ensure the provided response buffer is cleared for use
+  responseString = ""; // Ensure the provided response String is cleared for use
 
   buildPollHeaders(_pollHeaders, sizeof(_pollHeaders), lastModified, pollTimeout);
 
@@ -535,10 +2313,13 @@ ApiResponse ExositeHTTP::longPoll(const char* resource, char* responseBuffer, si
     return res;
   }
 
-  sendGetRequest("/onep:v1/stack/alias", resource, _clientToken, _pollHeaders);
+  if (!sendGetRequest("/onep:v1/stack/alias", resource.c_str(), _clientToken, _pollHeaders)) {
+    return res;
+  }
 
   // For longPoll() only, adjust the receive timeout to ensure complete processing of the request
   unsigned long effectiveTimeout = _rxTimeout + pollTimeout;
+  _deadlineExtra = pollTimeout;
 
   // Use the shared buffer to receive the HTTP response
   if (!readHttpResponse(_dataBuffer, sizeof(_dataBuffer), effectiveTimeout)) {
@@ -565,7 +2346,7 @@ ApiResponse ExositeHTTP::longPoll(const char* resource, char* responseBuffer, si
   else if (statusCode == 200) {
     char* body = strstr(_dataBuffer, "\r\n\r\n"); // Assume body starts after double CRLF
     if (!body) {
-      LOG_ERROR(G("Malformed response body"));
+      LOG_ERROR(G("Malformed HTTP response"));
       return res;
     }
     else {
@@ -580,7 +2361,10 @@ ApiResponse ExositeHTTP::longPoll(const char* resource, char* responseBuffer, si
 
       const char* value = delimiter + 1; // Skip past the delimiter, to just the value
 
-      res.success = urlDecode(value, responseBuffer, bufferSize);
+      res.success = urlDecode(value, responseString);
+      if (res.success) {
+        rbeForget(resource.c_str());
+      }
       return res;
     }
   }
@@ -589,27 +2373,66 @@ ApiResponse ExositeHTTP::longPoll(const char* resource, char* responseBuffer, si
     return res;
   }
 }
+#endif
 
-ApiResponse ExositeHTTP::longPoll(const String& resource, String& responseString, unsigned long lastModified, unsigned long pollTimeout) {
+ApiResponse ExositeHTTP::longPollMany(PollResource* resources, size_t count, unsigned long pollTimeout) {
   ApiResponse res;
   res.statusCode = 0;
   res.success = false;
 
-  responseString = ""; // Ensure the provided response String is cleared for use
+  if (!resources || count == 0) {
+    LOG_ERROR(G("No resources to poll"));
+    return res;
+  }
 
-  buildPollHeaders(_pollHeaders, sizeof(_pollHeaders), lastModified, pollTimeout);
+  // Build the query (e.g. `config_io&data_out`) in the shared buffer, and find the oldest cursor
+  size_t queryLen = 0;
+  unsigned long oldest = resources[0].lastModified;
+
+  for (size_t i = 0; i < count; i++) {
+    if (!resources[i].resource || !resources[i].buffer) {
+      LOG_ERROR(G("Missing resource or buffer to poll"));
+      return res;
+    }
+
+    resources[i].changed = false;
+    if (resources[i].bufferSize > 0) {
+      resources[i].buffer[0] = '\0'; // Ensure the provided response buffers are cleared for use
+    }
+
+    size_t len = strlen(resources[i].resource);
+    if (queryLen + len + 2 > sizeof(_dataBuffer)) {
+      LOG_ERROR(G("Too many resources to poll"));
+      return res;
+    }
+    if (i > 0) {
+      _dataBuffer[queryLen++] = '&';
+    }
+    memcpy(_dataBuffer + queryLen, resources[i].resource, len);
+    queryLen += len;
+
+    if (resources[i].lastModified < oldest) {
+      oldest = resources[i].lastModified;
+    }
+  }
+  _dataBuffer[queryLen] = '\0';
+
+  buildPollHeaders(_pollHeaders, sizeof(_pollHeaders), oldest, pollTimeout);
 
   if (!isConnected()) {
     LOG_ERROR(G("Failed to connect to server"));
     return res;
   }
 
-  sendGetRequest("/onep:v1/stack/alias", resource.c_str(), _clientToken, _pollHeaders);
+  if (!sendGetRequest("/onep:v1/stack/alias", _dataBuffer, _clientToken, _pollHeaders)) {
+    return res;
+  }
 
-  // For longPoll() only, adjust the receive timeout to ensure complete processing of the request
+  // For long polling only, adjust the receive timeout to ensure complete processing of the request
   unsigned long effectiveTimeout = _rxTimeout + pollTimeout;
+  _deadlineExtra = pollTimeout;
 
-  // Use the shared buffer to receive the HTTP response
+  // [Re]use the shared buffer to receive the HTTP response
   if (!readHttpResponse(_dataBuffer, sizeof(_dataBuffer), effectiveTimeout)) {
     LOG_ERROR(G("Failed to fully parse HTTP response"));
     LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
@@ -631,32 +2454,91 @@ ApiResponse ExositeHTTP::longPoll(const String& resource, String& responseString
     res.success = true;
     return res;
   }
-  else if (statusCode == 200) {
-    char* body = strstr(_dataBuffer, "\r\n\r\n"); // Assume body starts after double CRLF
-    if (!body) {
-      LOG_ERROR(G("Malformed HTTP response"));
-      return res;
+  else if (statusCode != 200) {
+    LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
+    return res;
+  }
+
+  // Determine the new cursor (epoch seconds) of all resources
+  unsigned long modified = 0;
+  const char* header = findHeader(_dataBuffer, "Last-Modified");
+  if (!header || !parseHttpDate(header, &modified)) {
+    modified = header ? strtoul(header, nullptr, 10) : 0;
+  }
+  header = findHeader(_dataBuffer, "Date");
+  if (!modified && header) {
+    parseHttpDate(header, &modified);
+  }
+  if (!modified) {
+    // Neither header, so estimate the server time (or keep the previous cursors, if unknown)
+    clockAdvance();
+    if (_clockValid) {
+      modified = (unsigned long)((_clockEpochMs + (millis() - _clockRef)) / 1000);
     }
-    else {
-      body += 4; // Skip past double CRLF ("\r\n\r\n")
+  }
 
-      // Confirm the response body matches the expected structure
-      const char* delimiter = strchr(body, '=');
-      if (!delimiter || *(delimiter + 1) == '\0') {
-        LOG_ERROR(G("Malformed response body (not 'resource=value')"));
-        return res;
-      }
+  char* body = strstr(_dataBuffer, "\r\n\r\n"); // Assume body starts after double CRLF
+  if (!body) {
+    LOG_ERROR(G("Malformed HTTP response"));
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return res;
+  }
+  body += 4; // Skip past double CRLF ("\r\n\r\n")
 
-      const char* value = delimiter + 1; // Skip past the delimiter, to just the value
+  res.success = true;
 
-      res.success = urlDecode(value, responseString);
-      return res;
+  // Split the body (`resource=value&resource=value...`) in place
+  char* pair = body;
+  while (pair && *pair) {
+    char* next = strchr(pair, '&');
+    if (next) {
+      *next++ = '\0';
+    }
+
+    char* delimiter = strchr(pair, '=');
+    if (!delimiter) {
+      LOG_ERROR(G("Malformed response body (not 'resource=value')"));
+      res.success = false;
+      break;
+    }
+    *delimiter = '\0';
+    const char* value = delimiter + 1;
+
+    // Names are matched decoded (decoding in place never lengthens them)
+    if (!urlDecode(pair, pair, sizeof(_dataBuffer) - (pair - _dataBuffer))) {
+      res.success = false;
+      pair = next;
+      continue;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+      PollResource& entry = resources[i];
+      if (strcmp(entry.resource, pair) != 0) {
+        continue;
+      }
+
+      uint32_t valueHash = fnv1a(_fnvOffset, value, strlen(value));
+      if (entry.lastModified == 0 || valueHash != entry.valueHash) {
+        if (urlDecode(value, entry.buffer, entry.bufferSize)) {
+          entry.changed = true;
+          entry.valueHash = valueHash;
+          rbeForget(entry.resource);
+        }
+        else {
+          res.success = false;
+        }
+      }
+      break;
     }
+
+    pair = next;
   }
-  else {
-    LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
-    return res;
+
+  for (size_t i = 0; i < count && modified; i++) {
+    resources[i].lastModified = modified;
   }
+
+  return res;
 }
 
 ApiResponse ExositeHTTP::timestamp(unsigned long* serverTime) {
@@ -669,7 +2551,9 @@ ApiResponse ExositeHTTP::timestamp(unsigned long* serverTime) {
     return res;
   }
 
-  sendGetRequest("/timestamp", nullptr, nullptr, nullptr);
+  if (!sendGetRequest("/timestamp", nullptr, nullptr, nullptr)) {
+    return res;
+  }
 
   // Use the shared buffer to receive the HTTP response
   if (!readHttpResponse(_dataBuffer, sizeof(_dataBuffer), _rxTimeout)) {
@@ -693,6 +2577,7 @@ ApiResponse ExositeHTTP::timestamp(unsigned long* serverTime) {
     if (bodyPos) {
       bodyPos = bodyPos + 4;
       *serverTime = strtoul(bodyPos, nullptr, 10);
+      clockSample(*serverTime);
       res.success = true;
     }
   }
@@ -704,51 +2589,275 @@ ApiResponse ExositeHTTP::timestamp(unsigned long* serverTime) {
   return res;
 }
 
+ApiResponse ExositeHTTP::now(unsigned long* serverTime) {
+  clockAdvance();
+
+  if (_clockValid && clockError() <= _clockMaxError) {
+    ApiResponse res;
+    res.statusCode = 0;
+    res.success = true;
+
+    *serverTime = (unsigned long)((_clockEpochMs + (millis() - _clockRef)) / 1000);
+    return res;
+  }
+
+  LOG_DEBUG(G("Re-syncing server clock (estimated error: "), clockError(), G(" ms)"));
+  return timestamp(serverTime);
+}
+
+void ExositeHTTP::beginPipeline(bool retry) {
+  _pipelineCount = 0;
+  _pipelineRetry = retry;
+  _pipelineLost = false;
+}
+
+bool ExositeHTTP::pipelineWrite(const char* resource, const char* writeChars) {
+  if (!resource || !writeChars || _pipelineCount >= EXO_PIPELINE_DEPTH) {
+    LOG_ERROR(G("Cannot add write to pipeline"));
+    return false;
+  }
+
+  PipelineEntry& entry = _pipeline[_pipelineCount++];
+  entry.resource = resource;
+  entry.value = writeChars;
+  entry.answered = false;
+  entry.sent = pipelineConnected() && pipelineSend(entry);
+
+  return entry.sent;
+}
+
+bool ExositeHTTP::pipelineRead(const char* resource) {
+  if (!resource || _pipelineCount >= EXO_PIPELINE_DEPTH) {
+    LOG_ERROR(G("Cannot add read to pipeline"));
+    return false;
+  }
+
+  PipelineEntry& entry = _pipeline[_pipelineCount++];
+  entry.resource = resource;
+  entry.value = nullptr;
+  entry.answered = false;
+  entry.sent = pipelineConnected() && pipelineSend(entry);
+
+  return entry.sent;
+}
+
+size_t ExositeHTTP::endPipeline(ApiResponse* results, size_t maxResults, ReadHandler onRead) {
+  size_t count = _pipelineCount;
+  _pipelineCount = 0;
+
+  for (size_t i = 0; i < count && i < maxResults; i++) {
+    results[i].statusCode = 0;
+    results[i].success = false;
+  }
+
+  // Read the responses of the pipelined requests, in order
+  bool interrupted = false;
+  for (size_t i = 0; i < count && !interrupted; i++) {
+    PipelineEntry& entry = _pipeline[i];
+    if (!entry.sent) {
+      continue;
+    }
+
+    _requestStart = entry.start; // Round trip of this request (see: `clockSample()`)
+    if (!readFramedResponse(_dataBuffer, sizeof(_dataBuffer), _rxTimeout)) {
+      interrupted = true;
+      break;
+    }
+
+    ApiResponse res = pipelineResult(entry, onRead);
+    if (i < maxResults) {
+      results[i] = res;
+    }
+    entry.answered = true;
+
+    // Requests sent after this response will not be answered
+    const char* connection = findHeader(_dataBuffer, "Connection");
+    interrupted = connection && strncasecmp(connection, "close", 5) == 0;
+  }
+
+  if (interrupted || _pipelineLost) {
+    _client->stop(); // Responses may still be pending, so the connection cannot be reused
+  }
+
+  if (!_pipelineRetry) {
+    return count;
+  }
+
+  // Fall back to one request at a time on a fresh connection
+  for (size_t i = 0; i < count; i++) {
+    PipelineEntry& entry = _pipeline[i];
+    if (entry.answered) {
+      continue;
+    }
+    else if (entry.sent && entry.value) {
+      LOG_ERROR(G("Pipelined write unanswered (not re-sent, may have been applied): "), entry.resource);
+      continue;
+    }
+
+    LOG_DEBUG(G("Re-sending pipelined request: "), entry.resource);
+
+    ApiResponse res;
+    res.statusCode = 0;
+    res.success = false;
+
+    if (!openConnection()) {
+      LOG_ERROR(G("Failed to connect to server"));
+    }
+    else if (pipelineSend(entry) && readHttpResponse(_dataBuffer, sizeof(_dataBuffer), _rxTimeout)) {
+      res = pipelineResult(entry, onRead);
+    }
+    else {
+      LOG_ERROR(G("Failed to fully parse HTTP response"));
+      LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    }
+
+    if (i < maxResults) {
+      results[i] = res;
+    }
+  }
+
+  return count;
+}
+
+bool ExositeHTTP::pipelineConnected() {
+  // The pipeline counts as a single request of the schedule (see: `prewarm()`)
+  if (_pipelineCount == 1) {
+    if (!isConnected()) {
+      LOG_ERROR(G("Failed to connect to server"));
+      return false;
+    }
+    return true;
+  }
+
+  // Later requests must share the connection of the earlier ones, so responses stay in order
+  if (_pipelineLost || !_client->connected()) {
+    LOG_ERROR(G("Pipeline connection lost, request not sent"));
+    _pipelineLost = true;
+    return false;
+  }
+
+  return true;
+}
+
+bool ExositeHTTP::pipelineSend(PipelineEntry& entry) {
+  if (entry.value) {
+    if (!urlEncode(entry.value, _dataBuffer, sizeof(_dataBuffer), _encoding)) {
+      return false;
+    }
+    if (!sendPostRequest("/onep:v1/stack/alias", entry.resource, strlen(entry.resource), _dataBuffer, _clientToken)) {
+      return false;
+    }
+  }
+  else if (!sendGetRequest("/onep:v1/stack/alias", entry.resource, _clientToken, nullptr)) {
+    return false;
+  }
+
+  entry.start = _requestStart;
+  return true;
+}
+
+ApiResponse ExositeHTTP::pipelineResult(const PipelineEntry& entry, ReadHandler onRead) {
+  ApiResponse res;
+  res.statusCode = 0;
+  res.success = false;
+
+  // Extract HTTP status code
+  int statusCode = 0;
+  if (sscanf(_dataBuffer, "HTTP/1.1 %d", &statusCode) != 1) {
+    LOG_ERROR(G("Could not parse HTTP status code"));
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return res;
+  }
+
+  res.statusCode = statusCode;
+
+  // Handle by HTTP status code
+  if (statusCode == 204) {
+    res.success = true;
+  }
+  else if (statusCode == 200 && !entry.value) {
+    char* body = strstr(_dataBuffer, "\r\n\r\n"); // Assume body starts after double CRLF
+    char* delimiter = body ? strchr(body + 4, '=') : nullptr;
+    if (!delimiter || *(delimiter + 1) == '\0') {
+      LOG_ERROR(G("Malformed response body (not 'resource=value')"));
+      LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+      return res;
+    }
+
+    // Decode in place (decoding never lengthens the value)
+    char* value = delimiter + 1;
+    res.success = urlDecode(value, value, sizeof(_dataBuffer) - (value - _dataBuffer));
+    if (res.success) {
+      rbeForget(entry.resource);
+    }
+    if (res.success && onRead) {
+      onRead(entry.resource, value);
+    }
+  }
+  else {
+    LOG_ERROR(G("Unexpected HTTP status: "), statusCode);
+  }
+
+  return res;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-bool ExositeHTTP::urlEncode(const char* src, char* dest, size_t destSize) {
+size_t ExositeHTTP::encodeChar(char c, char* dest, UrlEncoding encoding) {
   static const char hex[] = "0123456789ABCDEF";
+
+  if (('a' <= c && c <= 'z') ||
+      ('A' <= c && c <= 'Z') ||
+      ('0' <= c && c <= '9') ||
+      c == '-' || c == '_' || c == '.' || c == '~') {
+    dest[0] = c; // Unreserved characters are not encoded
+    return 1;
+  }
+  else if (encoding == URL_ENCODING_MINIMAL &&
+           c > ' ' && c < 0x7F && c != '&' && c != '=' && c != '+' && c != '%') {
+    dest[0] = c; // Printable ASCII, not significant in form bodies
+    return 1;
+  }
+  else if (c == ' ') {
+    dest[0] = '+'; // Space is replaced by a plus sign
+    return 1;
+  }
+
+  dest[0] = '%';
+  dest[1] = hex[(c >> 4) & 0x0F];
+  dest[2] = hex[c & 0x0F];
+  return 3;
+}
+
+bool ExositeHTTP::urlEncode(const char* src, char* dest, size_t destSize, UrlEncoding encoding) {
   const size_t maxSize = destSize - 1;
 
   size_t pos = 0;
   bool fullyEncoded = true;
 
   while (*src) {
-    if (pos < maxSize) { // Size check
-      char c = *src++;
-      if (('a' <= c && c <= 'z') || 
-          ('A' <= c && c <= 'Z') || 
-          ('0' <= c && c <= '9') || 
-          c == '-' || c == '_' || c == '.' || c == '~') {
-        dest[pos++] = c; // Unreserved characters are not encoded
-      }
-      else if (c == ' ') {
-        dest[pos++] = '+'; // Space is replaced by a plus sign
-      }
-      else {
-        // Ensure room for %HH
-        if (pos + 3 >= maxSize) {
-          LOG_ERROR(G("Encoded request body larger than internal buffer (≥"), destSize, G(" B)"));
-          fullyEncoded = false;
-          break;
-        }
-        else {
-          dest[pos++] = '%';
-          dest[pos++] = hex[(c >> 4) & 0x0F];
-          dest[pos++] = hex[c & 0x0F];
-        }
-      }
-    }
-    else {
+    char encoded[3];
+    size_t encodedLen = encodeChar(*src, encoded, encoding);
+
+    // Size check
+    if (pos + encodedLen > maxSize) {
       LOG_ERROR(G("Encoded request body larger than internal buffer (≥"), destSize, G(" B)"));
+      _bufferStats.overflows++;
       fullyEncoded = false;
       break;
     }
+
+    memcpy(dest + pos, encoded, encodedLen);
+    pos += encodedLen;
+    src++;
   }
 
   dest[pos] = '\0'; // Null-terminate the encoded value
 
-  if (!fullyEncoded) {
+  if (fullyEncoded) {
+    trackUsage(_bufferStats.encodedHighWater, pos, maxSize);
+  }
+  else {
     LOG_DEBUG(G("Encoded: "), dest);
     LOG_DEBUG(G("Remainder: "), src);
   }
@@ -756,6 +2865,35 @@ bool ExositeHTTP::urlEncode(const char* src, char* dest, size_t destSize) {
   return fullyEncoded;
 }
 
+bool ExositeHTTP::decodeBodyInPlace(ValueView& value) {
+  char* body = strstr(_dataBuffer, "\r\n\r\n"); // Assume body starts after double CRLF
+  if (!body) {
+    LOG_ERROR(G("Malformed HTTP response"));
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return false;
+  }
+
+  body += 4; // Skip past double CRLF ("\r\n\r\n")
+
+  // Confirm the response body matches the expected structure
+  char* delimiter = strchr(body, '=');
+  if (!delimiter || *(delimiter + 1) == '\0') {
+    LOG_ERROR(G("Malformed response body (not 'resource=value')"));
+    LOG_DEBUG(G("Raw response:\n"), _dataBuffer);
+    return false;
+  }
+
+  // Decoding never lengthens the value, so it is decoded over itself
+  char* encoded = delimiter + 1;
+  if (!urlDecode(encoded, encoded, sizeof(_dataBuffer) - (encoded - _dataBuffer))) {
+    return false;
+  }
+
+  value.data = encoded;
+  value.length = strlen(encoded);
+  return true;
+}
+
 bool ExositeHTTP::urlDecode(const char* src, char* dest, size_t destSize) {
   const size_t maxSize = destSize - 1;
 
@@ -806,6 +2944,7 @@ bool ExositeHTTP::urlDecode(const char* src, char* dest, size_t destSize) {
     }
     else {
       LOG_ERROR(G("Decoded response body larger than provided buffer (≥"), destSize, G(" B)"));
+      _bufferStats.overflows++;
       fullyDecoded = false;
       break;
     }
@@ -813,7 +2952,10 @@ bool ExositeHTTP::urlDecode(const char* src, char* dest, size_t destSize) {
 
   dest[pos] = '\0'; // Null-terminate the decoded value
 
-  if (!fullyDecoded) {
+  if (fullyDecoded) {
+    trackUsage(_bufferStats.decodedHighWater, pos, maxSize);
+  }
+  else {
     LOG_DEBUG(G("Decoded: "), dest);
     LOG_DEBUG(G("Remainder: "), src);
   }
@@ -821,6 +2963,7 @@ bool ExositeHTTP::urlDecode(const char* src, char* dest, size_t destSize) {
   return fullyDecoded;
 }
 
+#ifndef EXO_NO_HEAP
 bool ExositeHTTP::urlDecode(const String& input, String& responseString) {
   bool fullyDecoded = true;
 
@@ -866,10 +3009,14 @@ bool ExositeHTTP::urlDecode(const String& input, String& responseString) {
     }
   }
 
-  if (!fullyDecoded) {
+  if (fullyDecoded) {
+    trackUsage(_bufferStats.decodedHighWater, responseString.length(), 0);
+  }
+  else {
     LOG_DEBUG(G("Decoded: "), input);
     LOG_DEBUG(G("Remainder: "), responseString);
   }
 
   return fullyDecoded;
 }
+#endif
@@ -36,6 +36,8 @@
 #include <Arduino.h>
 #include <Client.h>
 
+#include "ExositeDeflate.h"
+
 //================================================================================================
 //                                      Optional Overrides
 //================================================================================================
@@ -46,9 +48,28 @@
 // Debug logging control (uncomment to enable)
 // #define EXO_DEBUG_LOGGING
 
+// Log levels compiled in, and size of the deferred log ring (uncomment to override)
+// #define EXO_LOG_LEVEL 1
+// #define EXO_LOG_RING_SIZE 256
+
+// Heap-free build: removes the `String` overloads that allocate, so that requests make no heap
+// allocation (checked by `test/test_no_heap.cpp`) (uncomment to enable)
+// #define EXO_NO_HEAP
+
 // String literals are stored in flash (PROGMEM) rather than RAM (uncomment to disable)
 // #define NO_FLASH_NET_STRINGS
 
+// Number of resources/channels tracked by report-by-exception (uncomment to override)
+// #define EXO_RBE_MAX_RESOURCES 4
+// #define EXO_RBE_MAX_CHANNELS 8
+
+// Number/length of resources registered with `registerResource()` (uncomment to override)
+// #define EXO_MAX_RESOURCES 4
+// #define EXO_RESOURCE_NAME_SIZE 32
+
+// Max number of requests in flight with `beginPipeline()` (uncomment to override)
+// #define EXO_PIPELINE_DEPTH 4
+
 //================================================================================================
 
 // Internal data buffer, used for:
@@ -64,53 +85,33 @@
   #warning "EXO_DATA_BUFFER_SIZE is fairly large. Ensure your target hardware has sufficient RAM."
 #endif
 
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-//                                  Variadic Templates (C++11)
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Report-by-exception tables (see: `setReportByException()`)
+#ifndef EXO_RBE_MAX_RESOURCES
+  #define EXO_RBE_MAX_RESOURCES 4
+#endif
+
+#ifndef EXO_RBE_MAX_CHANNELS
+  #define EXO_RBE_MAX_CHANNELS 8
+#endif
+
+// Registered resource table (see: `registerResource()`)
+#ifndef EXO_MAX_RESOURCES
+  #define EXO_MAX_RESOURCES 4
+#endif
 
-template<typename T>
-void logPrintItem(const T& item) {
-  Serial.print(item);
-}
+#ifndef EXO_RESOURCE_NAME_SIZE
+  #define EXO_RESOURCE_NAME_SIZE 32
+#endif
 
-template<typename T, typename... Rest>
-void logPrintItem(const T& item, const Rest&... rest) {
-  Serial.print(item);
-  logPrintItem(rest...);
-}
+// Request pipelining queue (see: `beginPipeline()`)
+#ifndef EXO_PIPELINE_DEPTH
+  #define EXO_PIPELINE_DEPTH 4
+#endif
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 //                                            Macros
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-// Error log formatting
-#define LOG_ERROR(...) do { \
-  if (Serial) { \
-    Serial.print("ERROR ("); \
-    Serial.print("line:"); \
-    Serial.print(__LINE__); \
-    Serial.print(") "); \
-    logPrintItem(__VA_ARGS__); \
-    Serial.println(); \
-  } \
-} while (0)
-
-// (Optional) Debug logging
-#ifdef EXO_DEBUG_LOGGING
-  #define LOG_DEBUG(...) do { \
-    if (Serial) { \
-      Serial.print("DEBUG ("); \
-      Serial.print("line:"); \
-      Serial.print(__LINE__); \
-      Serial.print(") "); \
-      logPrintItem(__VA_ARGS__); \
-      Serial.println(); \
-    } \
-  } while (0)
-#else
-  #define LOG_DEBUG(...) do {} while (0)
-#endif
-
 // (Optional) Store string literals in flash (PROGMEM) rather than RAM
 #if (defined(ESP8266) || defined(NO_FLASH_NET_STRINGS)) // Disabled for ESP, or manually
   #define G(x) x
@@ -118,6 +119,9 @@ void logPrintItem(const T& item, const Rest&... rest) {
   #define G(x) F(x)
 #endif
 
+// Error/debug logging (see: `ExositeLog`)
+#include "ExositeLog.h"
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 //                                       Custom Struct(s)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -130,6 +134,181 @@ struct ApiResponse {
   unsigned int statusCode;  // HTTP status code
 };
 
+/**
+ * @brief URL-encoding profile of request bodies (see: `setEncoding()`)
+ */
+enum UrlEncoding {
+  URL_ENCODING_STRICT,  // escape all but unreserved characters (`A-Z a-z 0-9 - _ . ~`)
+  URL_ENCODING_MINIMAL  // escape only characters significant in form bodies (`& = + %`, controls, non-ASCII)
+};
+
+/**
+ * @brief Formatting of decimal places of numeric values (see: `formatNumber()`)
+ */
+enum NumberFormat {
+  NUMBER_FORMAT_FIXED,    // exactly `precision` decimal places (e.g. `21.50`)
+  NUMBER_FORMAT_SHORTEST  // up to `precision` decimal places, without trailing zeros (e.g. `21.5`)
+};
+
+/**
+ * @brief Struct representing a decoded value held in the internal buffer (e.g. see: `read()`)
+ *
+ * Note: Only valid until the next request; `data` is null-terminated
+ */
+struct ValueView {
+  const char* data;  // decoded value (`""` if none)
+  size_t length;     // length of the decoded value
+};
+
+/**
+ * @brief Struct representing one resource monitored by `longPollMany()`
+ */
+struct PollResource {
+  const char* resource;        // resource to monitor (e.g. `data_out`)
+  char* buffer;                // buffer in which to store the decoded value (if changed)
+  size_t bufferSize;           // size of the provided `buffer`
+  unsigned long lastModified;  // epoch timestamp (seconds) of the last known update (`0` if none)
+  bool changed;                // set if a new value was received by the last `longPollMany()`
+  uint32_t valueHash;          // (internal) hash of the last received value; initialize to `0`
+};
+
+/**
+ * @brief Struct representing one cached resource value (see: `setReadCache()`)
+ */
+struct ReadCacheEntry {
+  const char* resource;        // resource to cache (e.g. `config_io`)
+  char* buffer;                // buffer in which to store the last decoded value
+  size_t bufferSize;           // size of the provided `buffer`
+  unsigned long lastModified;  // (internal) epoch timestamp (seconds) of the cached value; initialize to `0`
+  bool valid;                  // (internal) whether `buffer` holds the value; initialize to `false`
+};
+
+/**
+ * @brief Struct representing read cache counters (see: `setReadCache()`)
+ */
+struct ReadCacheStats {
+  unsigned long hits;        // reads answered from the cache (HTTP 304, no body transferred)
+  unsigned long misses;      // reads of a cached resource not answered from the cache (new value, or failed)
+  unsigned long bytesSaved;  // decoded bytes not transferred thanks to cache hits
+};
+
+/**
+ * @brief Struct representing report-by-exception counters (see: `setReportByException()`)
+ */
+struct ReportStats {
+  unsigned long sent;        // writes forwarded to the server
+  unsigned long suppressed;  // writes skipped as unchanged (or within deadband)
+  unsigned long heartbeats;  // unchanged writes sent successfully because the heartbeat interval elapsed
+};
+
+/**
+ * @brief Struct representing buffer usage high-water marks (see: `getBufferStats()`)
+ *
+ * Note: Lengths exclude the null terminator
+ */
+struct BufferStats {
+  size_t encodedHighWater;   // longest URL-encoded request value (in the internal buffer)
+  size_t headerHighWater;    // longest response headers (in the internal buffer)
+  size_t bodyHighWater;      // longest response body (in the internal buffer, after decompression)
+  size_t decodedHighWater;   // longest URL-decoded response value (in the provided buffer/String)
+  unsigned long nearMisses;  // operations that used >= 90% of their buffer
+  unsigned long overflows;   // operations that did not fit their buffer
+};
+
+/**
+ * @brief Struct representing connection instrumentation (see: `getConnectionStats()`)
+ */
+struct ConnectionStats {
+  unsigned long connects;          // successful connection attempts (incl. TLS handshake)
+  unsigned long connectFailures;   // failed connection attempts
+  unsigned long lastConnectMs;     // duration (ms) of the last connection attempt
+  unsigned long totalConnectMs;    // total duration (ms) of all connection attempts
+  unsigned long sessionRestores;   // connections attempted with a cached TLS session
+  unsigned long sessionResumes;    // connections that resumed the cached TLS session
+  unsigned long dnsHits;           // connections to a cached (unexpired) address
+  unsigned long dnsMisses;         // connections requiring an address lookup
+  unsigned long dnsStale;          // failed lookups that fell back to the last known address
+  unsigned long dnsSavedMs;        // estimated lookup time (ms) saved by cache hits
+  unsigned long warmHits;          // requests that found the connection already open
+  unsigned long coldStarts;        // requests that had to open the connection
+  unsigned long prewarms;          // connections opened ahead of time by `prewarm()`
+};
+
+/**
+ * @brief Interface to save/restore TLS session parameters of the secure client across reconnects
+ *
+ * Note: Implementations wrap the session API of the specific secure client (e.g. session ID or
+ *       ticket), which the generic `Client` interface does not expose
+ */
+class TlsSessionCache {
+  public:
+    virtual ~TlsSessionCache() {}
+
+    /**
+     * @brief Loads cached session parameters (if any) into the client, before it connects
+     *
+     * @param client  Secure client about to connect
+     * @param host    Domain of the server
+     *
+     * @return `true` if a cached session was loaded, `false` otherwise
+     */
+    virtual bool restore(Client* client, const char* host) = 0;
+
+    /**
+     * @brief Stores the session parameters of the client, after it connects
+     *
+     * @param client  Connected secure client
+     * @param host    Domain of the server
+     */
+    virtual void save(Client* client, const char* host) = 0;
+
+    /**
+     * @brief Determines whether the last handshake of the client resumed the restored session
+     *
+     * @param client  Connected secure client
+     *
+     * @return `true` if resumed, `false` if a full handshake was performed
+     */
+    virtual bool resumed(Client* client) = 0;
+};
+
+/**
+ * @brief Callback resolving a host name to an address (e.g. wrapping `DNSClient::getHostByName()`)
+ *
+ * @param host     Host name to resolve
+ * @param address  Resolved address
+ * @param ttlSec   Time-to-live (s) of the resolved address (leave unchanged if unknown)
+ *
+ * @return `true` if resolved, `false` otherwise
+ */
+typedef bool (*HostResolver)(const char* host, IPAddress& address, unsigned long& ttlSec);
+
+/**
+ * @brief Callback connecting the client to a resolved address, with SNI set to the host name
+ *
+ * @return Result of the client connection attempt (e.g. `1` if connected)
+ */
+typedef int (*AddressConnector)(Client* client, const IPAddress& address, const char* host, uint16_t port);
+
+/**
+ * @brief Callback receiving the decoded value of a read resource (e.g. see: `endPipeline()`)
+ *
+ * Note: `value` is only valid for the duration of the call
+ */
+typedef void (*ReadHandler)(const char* resource, const char* value);
+
+/**
+ * @brief Callback receiving the decoded value of a streamed read in parts (see: `readStream()`)
+ *
+ * Note: `data` is not null-terminated, and is only valid for the duration of the call
+ */
+typedef void (*ValueSink)(const char* data, size_t len, void* context);
+
+/**
+ * @brief Handle of a resource registered with `registerResource()` (negative if invalid)
+ */
+typedef int8_t ResourceHandle;
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
 class ExositeHTTP {
@@ -196,238 +375,1282 @@ class ExositeHTTP {
     void setTimeout(const unsigned long rxTimeoutMs);
 
     /**
-     * @brief Provision the device identity and receive a server-generated authentication token
+     * @brief Set/update the URL-encoding profile of request bodies
      *
-     * @param identity        Unique identity (e.g. MAC address) of the device
-     * @param responseBuffer  Buffer in which to store the returned token (>= 41 bytes)
-     * @param bufferSize      Size of the provided `responseBuffer`
+     * Note:
      *
-     * @return `true` if successful and a token was received (HTTP 200), `false` otherwise
+     * - `URL_ENCODING_STRICT` (default) escapes JSON characters (e.g. `{ } " : ,`) as 3 bytes each
+     *
+     * - `URL_ENCODING_MINIMAL` leaves them as-is, escaping only `&`, `=`, `+`, `%`, control, and
+     *   non-ASCII characters (spaces are still sent as `+`), which roughly halves a typical
+     *   channel payload
+     *
+     * @param encoding  URL-encoding profile
      */
-    ApiResponse provision(const char* identity, char* responseBuffer, size_t bufferSize);
+    void setEncoding(UrlEncoding encoding);
 
     /**
-     * @brief Provision the device identity and receive a server-generated authentication token
+     * @brief Enable/disable compression (deflate) of large POST request bodies
      *
-     * @param identity        Unique identity (e.g. MAC address) of the device
-     * @param responseString  String in which to store the returned token
+     * Note:
      *
-     * @return `true` if successful and a token was received (HTTP 200), `false` otherwise
+     * - When enabled, bodies of at least `minLength` bytes (URL-encoded) are sent with
+     *   `Content-Encoding: deflate`, and compressed responses are requested (`Accept-Encoding`)
+     *
+     * - Compressed (`deflate`/`gzip`) responses are always decompressed in place, within the
+     *   internal buffer
+     *
+     * - Compression is streamed to the client (computing `Content-Length` in a first pass), so
+     *   no additional buffer is used
+     *
+     * @param enabled    `true` to enable compression, `false` to send all bodies as-is (default)
+     * @param minLength  (Optional) Min length (B) of a body to be compressed (default: `512`)
      */
-    ApiResponse provision(const String& identity, String& responseString);
+    void setCompression(bool enabled, size_t minLength=512);
 
     /**
-     * @brief Write the provided value to the specified resource
+     * @brief Set/update the overall time budget (ms) of each API call
      *
-     * @param resource    Target resource (e.g. `data_in`)
-     * @param writeChars  Value to be written (e.g. `{"temp":23.5,"hum":40.1}`)
+     * Note:
      *
-     * @return `true` if successful (HTTP 204), `false` otherwise
+     * - The budget is shared by all phases of a call (address lookup, connect, send, receive), and
+     *   each phase is skipped or aborted (closing the connection) once it is exhausted
+     *
+     * - For `longPoll()` requests, the budget is extended by the `pollTimeout`
+     *
+     * - Blocking within the `Client` itself (e.g. `connect()`) can only be bounded if the client
+     *   honors `setTimeout()`
+     *
+     * @param budgetMs  Time budget (ms) of each call (`0` to disable; default)
      */
-    ApiResponse write(const char* resource, const char* writeChars);
+    void setRequestBudget(unsigned long budgetMs);
 
     /**
-     * @brief Write the provided value to the specified resource
-     *
-     * @param resource     Target resource (e.g. `data_in`)
-     * @param writeString  Value to be written (e.g. `{"temp":23.5,"hum":40.1}`)
+     * @brief Retrieve the buffer usage high-water marks (e.g. to right-size `EXO_DATA_BUFFER_SIZE`)
      *
-     * @return `true` if successful (HTTP 204), `false` otherwise
+     * @return Longest encoded/received/decoded lengths, and near-miss and overflow counts
      */
-    ApiResponse write(const String& resource, const String& writeString);
+    BufferStats getBufferStats();
 
     /**
-     * @brief Read the latest value of the specified resource
-     *
-     * Note:
+     * @brief Reset the buffer usage high-water marks and counters
+     */
+    void resetBufferStats();
+
+    /**
+     * @brief Set/update the TLS session cache used when [re]connecting to the server
      *
-     * - Response includes only `{value}` from the raw `{resource}={value}` request response
+     * @param cache  TLS session cache (or `nullptr` to disable)
+     */
+    void setSessionCache(TlsSessionCache* cache);
+
+    /**
+     * @brief Retrieve the connection instrumentation (e.g. handshake duration, session resumption)
      *
-     * @param resource        Resource to read (e.g. `data_out`)
-     * @param responseBuffer  Buffer in which to store the decoded response value (if any)
-     * @param bufferSize      Size of the provided `responseBuffer`
+     * @return Connection counters and timings (since construction)
+     */
+    ConnectionStats getConnectionStats();
+
+    /**
+     * @brief Retrieve the round-trip time of the last request (e.g. see: `ExositeRateController`)
      *
-     * @return `true` if successful (HTTP 200 or 204), `false` otherwise
+     * @return Time (ms) from sending the last request to the first byte of its response, or `0` if
+     *         no response was received (or no request was sent, e.g. suppressed by report-by-exception)
      */
-    ApiResponse read(const char* resource, char* responseBuffer, size_t bufferSize);
+    unsigned long lastRoundTrip();
 
     /**
-     * @brief Read the latest value of the specified resource
+     * @brief Set/update the resolver used to cache the server address across reconnects
      *
      * Note:
      *
-     * - Response includes only `{value}` from the raw `{resource}={value}` request response
+     * - Reconnects use `connect(IPAddress, port)` while the cached address is within its TTL, and
+     *   fall back to the last known address if a lookup fails
+
+     * - A failed connection to a cached address discards it, and is retried once with a fresh
+     *   lookup
      *
-     * @param resource        Resource to read (e.g. `data_out`)
-     * @param responseString  String in which to store the decoded response value (if any)
+     * - Secure clients must still present the host name (SNI); if `connect(IPAddress, port)` of
+     *   the client does not, provide a `connector` that sets it explicitly
      *
-     * @return `true` if successful (HTTP 200 or 204), `false` otherwise
+     * @param resolver    Host name resolver (or `nullptr` to connect by host name)
+     * @param connector   (Optional) Connects the client to the resolved address (default: `connect(IPAddress, port)`)
+     * @param defaultTtl  (Optional) TTL (s) of addresses resolved without one (default: `300`)
      */
-    ApiResponse read(const String& resource, String& responseString);
+    void setResolver(HostResolver resolver, AddressConnector connector=nullptr, unsigned long defaultTtl=300);
 
     /**
-     * @brief Blocking check/wait for a new value on the specified resource
+     * @brief Idle hook re-establishing the connection ahead of the next expected request
      *
      * Note:
      *
-     * - Response includes only `{value}` from the raw `{resource}={value}` request response
+     * - Call repeatedly while idle (e.g. in place of a `delay()` between scheduled writes)
      *
-     * @param resource        Resource to monitor (e.g. `data_out`)
-     * @param responseBuffer  Buffer in which to store the decoded response value (if any)
-     * @param bufferSize      Size of the provided `responseBuffer`
-     * @param lastModified    (Optional) Epoch timestamp (seconds) of the last known update; (default: `0`)
-     * @param pollTimeout     (Optional) Polling timeout in milliseconds (default: `5000`)
+     * - The next request is expected after the average interval between recent requests; once
+     *   within `leadMs` of it, a closed connection is re-opened (so the request finds it warm)
      *
-     * @return `true` if new data or pollTimeout reached (HTTP 200 or 304), `false` otherwise
+     * @param leadMs  (Optional) How far (ms) ahead of the next expected request to connect (default: `5000`)
+     *
+     * @return `true` if the connection is open, `false` otherwise
      */
-    ApiResponse longPoll(const char* resource, char* responseBuffer, size_t bufferSize,
-                         unsigned long lastModified=0, unsigned long pollTimeout=5000);
+    bool prewarm(unsigned long leadMs=5000);
 
     /**
-     * @brief Blocking check/wait for a new value on the specified resource
+     * @brief Enable/disable report-by-exception filtering of `write()` requests
      *
      * Note:
      *
-     * - Response includes only `{value}` from the raw `{resource}={value}` request response
+     * - When enabled, a `write()` of an unchanged value (per resource) is skipped, and returns
+     *   `success` with a `statusCode` of `304`
      *
-     * @param resource        Resource to monitor (e.g. `data_out`)
-     * @param responseString  String in which to store the decoded response value (if any)
-     * @param lastModified    (Optional) Epoch timestamp (seconds) of the last known update; (default: `0`)
-     * @param pollTimeout     (Optional) Polling timeout in milliseconds (default: `5000`)
+     * - Flat JSON object payloads (e.g. `{"001":1,"005":2.41}`) are compared per channel, applying
+     *   any deadband set with `setDeadband()`
      *
-     * @return `true` if new data or pollTimeout reached (HTTP 200 or 304), `false` otherwise
+     * - An unchanged value is still written once `heartbeatMs` has passed since the last write
+     *   (`0` disables the heartbeat)
+     *
+     * - A value received for a resource (by `read()`, `longPoll()`, etc.) clears its history, so
+     *   echoing it back (e.g. acknowledging a control command) is always written
+     *
+     * @param enabled      `true` to enable filtering, `false` to write every value (default)
+     * @param heartbeatMs  (Optional) Max interval (ms) between writes of a resource (default: `600000`)
      */
-    ApiResponse longPoll(const String& resource, String& responseString,
-                         unsigned long lastModified=0, unsigned long pollTimeout=5000);
+    void setReportByException(bool enabled, unsigned long heartbeatMs=600000);
 
     /**
-     * @brief Retrieve the current time from the server
+     * @brief Set/update the numeric deadband of a channel for report-by-exception filtering
      *
      * Note:
      *
-     * - This can be an unauthenticated request (e.g. to confirm general server connectivity)
+     * - A change of the channel value no greater than `deadband` is not considered a change
      *
-     * @return Current time from the server (epoch seconds), or `0` if the request fails
-     */
-    ApiResponse timestamp(unsigned long* serverTime);
-
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-
-  private:
-    Client* _client;
-
-    static const int _port = 443;
-
-    char _connector[128];
-    char _clientToken[41];
-
-    unsigned long _rxTimeout = 10000; // Timeout (ms) for request response (see: `setTimeout()`)
-
-    char _dataBuffer[EXO_DATA_BUFFER_SIZE]; // Internal buffer for cloud request/response handling
-
-    char _pollHeaders[64]; // Internal buffer for building Long Poll headers
-
-    unsigned int _flushDelay = 10; // Delay (ms) between availability checks when flushing socket data
-    unsigned int _flushTimeout = 200; // Timeout (ms) between bytes when flushing socket data
-
-    /**
-     * @brief Sets the domain (host) the internal `_client` will use for subsequent HTTP requests
+     * - Channels are matched by key (e.g. `001`) in every written resource, with the last written
+     *   value kept per resource
      *
-     * @param domain Domain name of the IoT Connector (e.g. "a5b9czkndm4g00000.m2.exosite.io")
+     * @param channel   Channel key within a JSON object payload (e.g. `005`)
+     * @param deadband  Absolute deadband of the channel value (e.g. `0.05`)
+     *
+     * @return `true` if set, `false` if the channel table is full (see: `EXO_RBE_MAX_CHANNELS`)
      */
-    void setDomain(const char* domain);
+    bool setDeadband(const char* channel, float deadband);
 
     /**
-     * @brief Flushes the client connection buffer, clearing any incoming/outgoing data
+     * @brief Forget all previously written values, so the next `write()` of each resource is sent
      */
-    void flushClient();
+    void clearReportHistory();
 
     /**
-     * @brief Checks if the client is connected to the server
-     * 
-     * Note: If not, returns the result of an attempt to connect
+     * @brief Retrieve the report-by-exception counters
      *
-     * @return `true` if connected, `false` otherwise
+     * @return Counts of sent, suppressed, and heartbeat writes (since construction)
      */
-    bool isConnected();
+    ReportStats getReportStats();
 
     /**
-     * @brief Determines whether the specified time interval has passed
+     * @brief Set/update the cache of resource values used by `read()` (conditional reads)
      *
-     * @param start     Start time (ms) (e.g. from `millis()`)
-     * @param duration  Duration (ms) to check against
+     * Note:
      *
-     * @return `true` if the time has expired, `false` otherwise
-     */
-    bool timeExpired(unsigned long start, unsigned long duration);
-
-    /**
-     * @brief Reads the full HTTP response from the server into a buffer
+     * - Reads of a cached resource send `If-Modified-Since` with the time of the cached value; a
+     *   `304 Not Modified` response then returns the cached value (with `statusCode` `304`),
+     *   without transferring the body
      *
-     * @param destBuffer  Buffer in which to store the full HTTP response
-     * @param bufferSize  Size of the destination buffer
-     * @param timeoutMs   Timeout (ms) for awaiting/reading-in the response
+     * - Applies to `read()` by buffer, `String`, `ValueView`, or handle (not pipelined reads)
      *
-     * @return `true` if the response was read successfully, `false` on timeout or error
+     * @param entries  Array of cached resources (or `nullptr` to disable), with their buffers
+     * @param count    Number of entries
      */
-    bool readHttpResponse(char* destBuffer, size_t bufferSize, unsigned long timeoutMs);
+    void setReadCache(ReadCacheEntry* entries, size_t count);
 
     /**
-     * @brief Sends an HTTP GET request to the specified path
+     * @brief Retrieve the read cache counters (e.g. hit rate)
      *
-     * @param path          API endpoint
-     * @param resource      (Optional) Resource alias to be queried
-     * @param authToken     (Optional) Client auth token
-     * @param extraHeaders  (Optional) Additional headers to be included (e.g. for `longPoll()`)
+     * @return Read cache counters (since construction)
      */
-    void sendGetRequest(const char* path,
-                        const char* resource=nullptr, const char* authToken=nullptr, const char* extraHeaders=nullptr);
+    ReadCacheStats getReadCacheStats();
 
     /**
-     * @brief Sends an HTTP POST request to the specified path, with a single key/value pair in the body
+     * @brief Register a resource, for use by handle with `write()`, `read()`, and `longPoll()`
      *
-     * @param path       API endpoint
-     * @param key        Key to send in the POST body
-     * @param value      Value to associate with the key in the POST body
-     * @param authToken  (Optional) Client auth token
-     */
-    void sendPostRequest(const char* path, const char* key, const char* value,
-                         const char* authToken=nullptr);
-
-    /**
-     * @brief Constructs HTTP headers for a Long Poll request (`Last-Modified` and `Request-Timeout`)
+     * Note:
      *
-     * @param buffer         Buffer in which to store the headers
-     * @param bufferSize     Size of the destination buffer
-     * @param lastModified   Timestamp (ms) for the `Last-Modified` header
-     * @param pollTimeoutMs  Timeout (ms) for the `Request-Timeout` header
+     * - The alias is URL-encoded once, at registration, and its hash and encoded length are kept
+     *   in a fixed table (see: `EXO_MAX_RESOURCES`)
+     *
+     * - Registering an already registered alias returns its existing handle
+     *
+     * @param resource  Resource alias (e.g. `data_out`)
+     * @param handler   (Optional) Callback receiving each value read by handle (e.g. for dispatch)
+     *
+     * @return Handle of the resource, or `-1` if the table is full or the alias is too long
      */
-    void buildPollHeaders(char* buffer, size_t bufferSize, unsigned long lastModified, unsigned long pollTimeoutMs);
+    ResourceHandle registerResource(const char* resource, ReadHandler handler=nullptr);
 
     /**
-     * @brief URL-encodes a value into the destination buffer
+     * @brief Find the handle of a registered resource
      *
-     * @param src       Source value to be encoded
-     * @param dest      Buffer in which to store the encoded value
-     * @param destSize  Size of the destination buffer
+     * @param resource  Resource alias (e.g. `data_out`)
      *
-     * @return `true` if encoding was successful, `false` on error or (e.g. insufficient buffer)
+     * @return Handle of the resource, or `-1` if not registered
      */
-    bool urlEncode(const char* src, char* dest, size_t destSize);
+    ResourceHandle findResource(const char* resource);
 
     /**
-     * @brief URL-decodes an encoded value into a buffer
+     * @brief Retrieve the alias of a registered resource
      *
-     * @param src       Source value to be decoded
-     * @param dest      Buffer in which to store the decoded value
-     * @param destSize  Size of the destination buffer
+     * @param handle  Handle of the resource
      *
-     * @return `true` if the decoding was successful, `false` on error or (e.g. insufficient buffer)
+     * @return Resource alias, or `nullptr` if the handle is invalid
      */
-    bool urlDecode(const char* src, char* dest, size_t destSize);
+    const char* resourceName(ResourceHandle handle);
 
     /**
-     * @brief URL-decodes an encoded value into a buffer
+     * @brief Provision the device identity and receive a server-generated authentication token
+     *
+     * @param identity        Unique identity (e.g. MAC address) of the device
+     * @param responseBuffer  Buffer in which to store the returned token (>= 41 bytes)
+     * @param bufferSize      Size of the provided `responseBuffer`
+     *
+     * @return `true` if successful and a token was received (HTTP 200), `false` otherwise
+     */
+    ApiResponse provision(const char* identity, char* responseBuffer, size_t bufferSize);
+
+#ifndef EXO_NO_HEAP
+    /**
+     * @brief Provision the device identity and receive a server-generated authentication token
+     *
+     * @param identity        Unique identity (e.g. MAC address) of the device
+     * @param responseString  String in which to store the returned token
+     *
+     * @return `true` if successful and a token was received (HTTP 200), `false` otherwise
+     */
+    ApiResponse provision(const String& identity, String& responseString);
+#endif
+
+    /**
+     * @brief Write the provided value to the specified resource
+     *
+     * @param resource    Target resource (e.g. `data_in`)
+     * @param writeChars  Value to be written (e.g. `{"temp":23.5,"hum":40.1}`)
+     *
+     * @return `true` if successful (HTTP 204) or suppressed by report-by-exception (`304`), `false` otherwise
+     */
+    ApiResponse write(const char* resource, const char* writeChars);
+
+    /**
+     * @brief Write the provided value to the specified resource
+     *
+     * @param resource     Target resource (e.g. `data_in`)
+     * @param writeString  Value to be written (e.g. `{"temp":23.5,"hum":40.1}`)
+     *
+     * @return `true` if successful (HTTP 204) or suppressed by report-by-exception (`304`), `false` otherwise
+     */
+    ApiResponse write(const String& resource, const String& writeString);
+
+    /**
+     * @brief Write the provided value to the registered resource
+     *
+     * @param handle      Handle of the target resource (see: `registerResource()`)
+     * @param writeChars  Value to be written (e.g. `{"temp":23.5,"hum":40.1}`)
+     *
+     * @return `true` if successful (HTTP 204) or suppressed by report-by-exception (`304`), `false` otherwise
+     */
+    ApiResponse write(ResourceHandle handle, const char* writeChars);
+
+    /**
+     * @brief Read the latest value of the specified resource
+     *
+     * Note:
+     *
+     * - Response includes only `{value}` from the raw `{resource}={value}` request response
+     *
+     * @param resource        Resource to read (e.g. `data_out`)
+     * @param responseBuffer  Buffer in which to store the decoded response value (if any)
+     * @param bufferSize      Size of the provided `responseBuffer`
+     *
+     * @return `true` if successful (HTTP 200 or 204, or 304 if cached; see: `setReadCache()`), `false` otherwise
+     */
+    ApiResponse read(const char* resource, char* responseBuffer, size_t bufferSize);
+
+#ifndef EXO_NO_HEAP
+    /**
+     * @brief Read the latest value of the specified resource
+     *
+     * Note:
+     *
+     * - Response includes only `{value}` from the raw `{resource}={value}` request response
+     *
+     * @param resource        Resource to read (e.g. `data_out`)
+     * @param responseString  String in which to store the decoded response value (if any)
+     *
+     * @return `true` if successful (HTTP 200 or 204, or 304 if cached; see: `setReadCache()`), `false` otherwise
+     */
+    ApiResponse read(const String& resource, String& responseString);
+#endif
+
+    /**
+     * @brief Read the latest value of the registered resource
+     *
+     * Note: A received value is also passed to the handler of the resource (if any)
+     *
+     * @param handle          Handle of the resource to read (see: `registerResource()`)
+     * @param responseBuffer  Buffer in which to store the decoded response value (if any)
+     * @param bufferSize      Size of the provided `responseBuffer`
+     *
+     * @return `true` if successful (HTTP 200 or 204, or 304 if cached; see: `setReadCache()`), `false` otherwise
+     */
+    ApiResponse read(ResourceHandle handle, char* responseBuffer, size_t bufferSize);
+
+    /**
+     * @brief Read the latest value of the specified resource, without copying it
+     *
+     * Note: The value is decoded in place, in the internal buffer, so `value` is only valid until
+     * the next request
+     *
+     * @param resource  Resource to read (e.g. `data_out`)
+     * @param value     View of the decoded response value (empty if none)
+     *
+     * @return `true` if successful (HTTP 200 or 204, or 304 if cached; see: `setReadCache()`), `false` otherwise
+     */
+    ApiResponse read(const char* resource, ValueView& value);
+
+    /**
+     * @brief Read the latest value of the specified resource, as an integer
+     *
+     * @param resource  Resource to read (e.g. `data_out`)
+     * @param value     Parsed value (unchanged if none, HTTP 204)
+     *
+     * @return `true` if successful (HTTP 200 or 204, or 304 if cached), `false` otherwise (incl. not an
+     *         integer, or out of the range of `long`)
+     */
+    ApiResponse readInt(const char* resource, long& value);
+
+    /**
+     * @brief Read the latest value of the specified resource, as a floating point number
+     *
+     * @param resource  Resource to read (e.g. `data_out`)
+     * @param value     Parsed value (unchanged if none, HTTP 204)
+     *
+     * @return `true` if successful (HTTP 200 or 204, or 304 if cached), `false` otherwise (incl. not a
+     *         number, or out of the range of `float`)
+     */
+    ApiResponse readFloat(const char* resource, float& value);
+
+    /**
+     * @brief Read the latest value of the specified resource, as a boolean
+     *
+     * Note: Accepts `1`/`0`, `true`/`false`, and `on`/`off` (case-insensitive)
+     *
+     * @param resource  Resource to read (e.g. `data_out`)
+     * @param value     Parsed value (unchanged if none, HTTP 204)
+     *
+     * @return `true` if successful (HTTP 200 or 204, or 304 if cached), `false` otherwise (incl. not a boolean)
+     */
+    ApiResponse readBool(const char* resource, bool& value);
+
+    /**
+     * @brief Read the latest value of the specified resource, decoding it as it arrives
+     *
+     * Note:
+     *
+     * - The value is passed to `sink` in parts, as it is received and decoded, so values larger
+     *   than the internal buffer (e.g. `config_io`) can be processed in constant memory (e.g. with
+     *   `ExositeJsonStream::sink`)
+     *
+     * - The response is requested without compression, and bypasses the read cache
+     *
+     * @param resource  Resource to read (e.g. `config_io`)
+     * @param sink      Callback receiving each decoded part of the value
+     * @param context   (Optional) Context pointer passed to the sink
+     *
+     * @return `true` if successful (HTTP 200 or 204), `false` otherwise (incl. a partially received value)
+     */
+    ApiResponse readStream(const char* resource, ValueSink sink, void* context=nullptr);
+
+    /**
+     * @brief Blocking check/wait for a new value on the specified resource
+     *
+     * Note:
+     *
+     * - Response includes only `{value}` from the raw `{resource}={value}` request response
+     *
+     * @param resource        Resource to monitor (e.g. `data_out`)
+     * @param responseBuffer  Buffer in which to store the decoded response value (if any)
+     * @param bufferSize      Size of the provided `responseBuffer`
+     * @param lastModified    (Optional) Epoch timestamp (seconds) of the last known update; (default: `0`)
+     * @param pollTimeout     (Optional) Polling timeout in milliseconds (default: `5000`)
+     *
+     * @return `true` if new data or pollTimeout reached (HTTP 200 or 304), `false` otherwise
+     */
+    ApiResponse longPoll(const char* resource, char* responseBuffer, size_t bufferSize,
+                         unsigned long lastModified=0, unsigned long pollTimeout=5000);
+
+#ifndef EXO_NO_HEAP
+    /**
+     * @brief Blocking check/wait for a new value on the specified resource
+     *
+     * Note:
+     *
+     * - Response includes only `{value}` from the raw `{resource}={value}` request response
+     *
+     * @param resource        Resource to monitor (e.g. `data_out`)
+     * @param responseString  String in which to store the decoded response value (if any)
+     * @param lastModified    (Optional) Epoch timestamp (seconds) of the last known update; (default: `0`)
+     * @param pollTimeout     (Optional) Polling timeout in milliseconds (default: `5000`)
+     *
+     * @return `true` if new data or pollTimeout reached (HTTP 200 or 304), `false` otherwise
+     */
+    ApiResponse longPoll(const String& resource, String& responseString,
+                         unsigned long lastModified=0, unsigned long pollTimeout=5000);
+#endif
+
+    /**
+     * @brief Blocking check/wait for a new value on the registered resource
+     *
+     * Note: A received value is also passed to the handler of the resource (if any)
+     *
+     * @param handle          Handle of the resource to monitor (see: `registerResource()`)
+     * @param responseBuffer  Buffer in which to store the decoded response value (if any)
+     * @param bufferSize      Size of the provided `responseBuffer`
+     * @param lastModified    (Optional) Epoch timestamp (seconds) of the last known update; (default: `0`)
+     * @param pollTimeout     (Optional) Polling timeout in milliseconds (default: `5000`)
+     *
+     * @return `true` if new data or pollTimeout reached (HTTP 200 or 304), `false` otherwise
+     */
+    ApiResponse longPoll(ResourceHandle handle, char* responseBuffer, size_t bufferSize,
+                         unsigned long lastModified=0, unsigned long pollTimeout=5000);
+
+    /**
+     * @brief Blocking check/wait for a new value on the specified resource, without copying it
+     *
+     * Note: The value is decoded in place, in the internal buffer, so `value` is only valid until
+     * the next request
+     *
+     * @param resource      Resource to monitor (e.g. `data_out`)
+     * @param value         View of the decoded response value (empty if none)
+     * @param lastModified  (Optional) Epoch timestamp (seconds) of the last known update; (default: `0`)
+     * @param pollTimeout   (Optional) Polling timeout in milliseconds (default: `5000`)
+     *
+     * @return `true` if new data or pollTimeout reached (HTTP 200 or 304), `false` otherwise
+     */
+    ApiResponse longPoll(const char* resource, ValueView& value,
+                         unsigned long lastModified=0, unsigned long pollTimeout=5000);
+
+    /**
+     * @brief Blocking check/wait for a new value on any of the specified resources
+     *
+     * Note:
+     *
+     * - A single request reads all resources, waiting (up to `pollTimeout`) for an update newer
+     *   than the oldest `lastModified` of the resources
+     *
+     * - The response holds the current value of every resource, so `changed` is set only for
+     *   resources whose value differs from the last one received (or with no `lastModified`)
+     *
+     * - On a response, `lastModified` of every resource is advanced to the server's
+     *   `Last-Modified` (or `Date`) time, else to the estimated server time (see: `now()`), if known
+     *
+     * @param resources    Array of resources to monitor (with their buffers and cursors)
+     * @param count        Number of resources in the array
+     * @param pollTimeout  (Optional) Polling timeout in milliseconds (default: `5000`)
+     *
+     * @return `true` if new data or pollTimeout reached (HTTP 200 or 304), `false` otherwise
+     */
+    ApiResponse longPollMany(PollResource* resources, size_t count, unsigned long pollTimeout=5000);
+
+    /**
+     * @brief Retrieve the current time from the server
+     *
+     * Note:
+     *
+     * - This can be an unauthenticated request (e.g. to confirm general server connectivity)
+     *
+     * @return Current time from the server (epoch seconds), or `0` if the request fails
+     */
+    ApiResponse timestamp(unsigned long* serverTime);
+
+    /**
+     * @brief Retrieve the current server time, estimated locally where possible
+     *
+     * Note:
+     *
+     * - The server clock is tracked against `millis()` using round-trip compensated samples from
+     *   `timestamp()` and from the `Date` header of every other response
+     *
+     * - A request (i.e. `timestamp()`) is only made while the estimated error exceeds the
+     *   tolerance set with `setClockTolerance()`; otherwise `statusCode` is `0`
+     *
+     * @param serverTime  Current time from the server (epoch seconds)
+     *
+     * @return `true` if estimated or successfully requested, `false` otherwise
+     */
+    ApiResponse now(unsigned long* serverTime);
+
+    /**
+     * @brief Set/update the tolerated error of the locally estimated server time (see: `now()`)
+     *
+     * @param maxErrorMs  Max estimated error (ms) before re-syncing with the server (default: `2000`)
+     * @param driftPpm    (Optional) Assumed drift of the local clock (ppm) (default: `100`)
+     */
+    void setClockTolerance(unsigned long maxErrorMs, unsigned long driftPpm=100);
+
+    /**
+     * @brief Begin a pipeline of requests, sent back-to-back on one connection
+     *
+     * Note:
+     *
+     * - Requests are sent by `pipelineWrite()`/`pipelineRead()` without awaiting a response, and
+     *   the responses are read (in order) by `endPipeline()`
+     *
+     * - If the connection is lost, later requests are not sent; if the server closes the
+     *   connection (or a response cannot be framed), the remaining requests are unanswered
+     *
+     * - With `retry`, unsent requests and unanswered reads are re-sent one at a time by
+     *   `endPipeline()`; unanswered writes are never re-sent (the server may have applied them)
+     *
+     * - No other request may be made until `endPipeline()` is called
+     *
+     * @param retry  (Optional) Re-send requests that were not sent or answered (default: `false`)
+     */
+    void beginPipeline(bool retry=false);
+
+    /**
+     * @brief Send a write request as part of the pipeline started with `beginPipeline()`
+     *
+     * Note:
+     *
+     * - `resource` and `writeChars` must remain valid until `endPipeline()` is called
+     *
+     * - Pipelined writes are not filtered by report-by-exception
+     *
+     * @param resource    Target resource (e.g. `data_in`)
+     * @param writeChars  Value to be written (e.g. `{"temp":23.5,"hum":40.1}`)
+     *
+     * @return `true` if sent, `false` if the pipeline is full or the request could not be sent
+     */
+    bool pipelineWrite(const char* resource, const char* writeChars);
+
+    /**
+     * @brief Send a read request as part of the pipeline started with `beginPipeline()`
+     *
+     * Note: `resource` must remain valid until `endPipeline()` is called
+     *
+     * @param resource  Resource to read (e.g. `data_out`)
+     *
+     * @return `true` if sent, `false` if the pipeline is full or the request could not be sent
+     */
+    bool pipelineRead(const char* resource);
+
+    /**
+     * @brief Receive the responses of all requests sent since `beginPipeline()`
+     *
+     * @param results     Array in which to store the result of each request (in order sent; a
+     *                    request not sent or answered has `success=false` and `statusCode=0`)
+     * @param maxResults  Size of the `results` array
+     * @param onRead      (Optional) Callback receiving the decoded value of each read resource
+     *
+     * @return Number of requests in the pipeline
+     */
+    size_t endPipeline(ApiResponse* results, size_t maxResults, ReadHandler onRead=nullptr);
+
+    /**
+     * @brief Begin building a channel payload (e.g. `{"001":1,"005":2.41}`) for `writeChannels()`
+     *
+     * Note:
+     *
+     * - The payload is URL-encoded directly into the internal buffer as channels are added, so
+     *   no other request may be made until `writeChannels()` is called
+     */
+    void beginChannels();
+
+    /**
+     * @brief Add a boolean channel value to the payload started with `beginChannels()`
+     *
+     * @param channel  Channel key (e.g. `001`)
+     * @param value    Channel value
+     *
+     * @return `true` if added, `false` if the internal buffer is full
+     */
+    bool addChannel(const char* channel, bool value);
+
+    /**
+     * @brief Add an integer channel value to the payload started with `beginChannels()`
+     *
+     * @param channel  Channel key (e.g. `001`)
+     * @param value    Channel value
+     *
+     * @return `true` if added, `false` if the internal buffer is full
+     */
+    bool addChannel(const char* channel, int value);
+
+    /**
+     * @brief Add an integer channel value to the payload started with `beginChannels()`
+     *
+     * @param channel  Channel key (e.g. `001`)
+     * @param value    Channel value
+     *
+     * @return `true` if added, `false` if the internal buffer is full
+     */
+    bool addChannel(const char* channel, long value);
+
+    /**
+     * @brief Add a numeric channel value to the payload started with `beginChannels()`
+     *
+     * Note: Non-finite values (NaN, infinity) are written as `null`, and values beyond 1.8e19 in
+     * exponent notation (see: `formatNumber()`)
+     *
+     * @param channel    Channel key (e.g. `005`)
+     * @param value      Channel value
+     * @param precision  (Optional) Number of decimal places, per the channel's `precision` (default: `2`)
+     * @param format     (Optional) Formatting of the decimal places (default: `NUMBER_FORMAT_FIXED`)
+     *
+     * @return `true` if added, `false` if the internal buffer is full
+     */
+    bool addChannel(const char* channel, double value, unsigned int precision=2,
+                    NumberFormat format=NUMBER_FORMAT_FIXED);
+
+    /**
+     * @brief Format a number as a JSON value, without `printf()`
+     *
+     * Note:
+     *
+     * - Uses integer arithmetic and a digit-pair table, with 32-bit division for values that fit
+     *
+     * - Precision is limited to 9 decimal places, and reduced for very large values (beyond 1e18)
+     *
+     * - Values beyond 1.8e19 are formatted in exponent notation, with up to 15 significant digits
+     *   (e.g. `2.5e19`)
+     *
+     * - Non-finite values (NaN, infinity) are formatted as `null`
+     *
+     * @param value      Value to be formatted
+     * @param precision  Number of decimal places
+     * @param dest       Buffer in which to store the formatted value (>= 32 bytes)
+     * @param format     (Optional) Formatting of the decimal places (default: `NUMBER_FORMAT_FIXED`)
+     *
+     * @return Length of the formatted value
+     */
+    static size_t formatNumber(double value, unsigned int precision, char* dest,
+                               NumberFormat format=NUMBER_FORMAT_FIXED);
+
+    /**
+     * @brief Format an integer as a JSON value, without `printf()`
+     *
+     * @param value  Value to be formatted
+     * @param dest   Buffer in which to store the formatted value (>= 21 bytes)
+     *
+     * @return Length of the formatted value
+     */
+    static size_t formatInteger(long value, char* dest);
+
+    /**
+     * @brief Write the channel payload built since `beginChannels()` to the specified resource
+     *
+     * @param resource  Target resource (e.g. `data_in`)
+     *
+     * @return `true` if successful (HTTP 204) or suppressed by report-by-exception (`304`), `false` otherwise
+     */
+    ApiResponse writeChannels(const char* resource);
+
+    /**
+     * @brief Write the channel payload built since `beginChannels()` to the registered resource
+     *
+     * @param handle  Handle of the target resource (see: `registerResource()`)
+     *
+     * @return `true` if successful (HTTP 204) or suppressed by report-by-exception (`304`), `false` otherwise
+     */
+    ApiResponse writeChannels(ResourceHandle handle);
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  private:
+    Client* _client;
+
+    static const int _port = 443;
+
+    char _connector[128];
+    char _clientToken[41];
+
+    unsigned long _rxTimeout = 10000; // Timeout (ms) for request response (see: `setTimeout()`)
+
+    UrlEncoding _encoding = URL_ENCODING_STRICT; // URL-encoding profile (see: `setEncoding()`)
+
+    bool _compress = false;           // Whether to compress large request bodies (see: `setCompression()`)
+    size_t _compressMin = 512;
+
+    unsigned long _budget = 0;        // Time budget (ms) of each API call (see: `setRequestBudget()`)
+    unsigned long _deadlineStart = 0; // Time (ms) the current API call started
+    unsigned long _deadlineExtra = 0; // Budget extension (ms) of the current API call (e.g. poll timeout)
+
+    BufferStats _bufferStats = {};
+
+    TlsSessionCache* _sessionCache = nullptr;
+    ConnectionStats _connectionStats = {};
+
+    // Server address cache (see: `setResolver()`)
+    HostResolver _resolver = nullptr;
+    AddressConnector _addressConnector = nullptr;
+    unsigned long _dnsDefaultTtl = 300;
+    bool _dnsValid = false;
+    uint32_t _dnsHostHash = 0;       // Hash of the `_connector` the address was resolved for
+    IPAddress _dnsAddress;
+    unsigned long _dnsResolvedAt = 0; // Time (ms) of the last successful lookup
+    unsigned long _dnsTtlMs = 0;
+    unsigned long _dnsLookupMs = 0;   // Average duration (ms) of a lookup
+
+    // Request schedule tracking (see: `prewarm()`)
+    unsigned long _lastRequestAt = 0;   // Time (ms) of the last request
+    unsigned long _requestInterval = 0; // Average interval (ms) between requests
+    unsigned int _requestSamples = 0;
+    bool _prewarmed = false;            // Whether `prewarm()` connected since the last request
+
+    char _dataBuffer[EXO_DATA_BUFFER_SIZE]; // Internal buffer for cloud request/response handling
+
+    char _pollHeaders[64]; // Internal buffer for building Long Poll headers
+
+    unsigned int _flushDelay = 10; // Delay (ms) between availability checks when flushing socket data
+    unsigned int _flushTimeout = 200; // Timeout (ms) between bytes when flushing socket data
+
+    // Report-by-exception state (see: `setReportByException()`)
+    struct RbeResource {
+      bool used;
+      uint32_t aliasHash;     // FNV-1a hash of the resource alias
+      uint32_t valueHash;     // FNV-1a hash of the last written value (excluding deadband channels)
+      unsigned long lastSent; // Time (ms) of the last write
+      uint32_t hasValues;     // Bitmask of the deadband channels with a last written value
+      float values[EXO_RBE_MAX_CHANNELS]; // Last written value of each deadband channel
+    };
+
+    struct RbeChannel {
+      char key[8];
+      float deadband;
+      float pending;  // Value of the write in progress
+      bool hasPending;
+    };
+
+    bool _rbeEnabled = false;
+    unsigned long _rbeHeartbeat = 600000;
+
+    RbeResource _rbeResources[EXO_RBE_MAX_RESOURCES] = {};
+    RbeChannel _rbeChannels[EXO_RBE_MAX_CHANNELS] = {};
+    unsigned int _rbeChannelCount = 0;
+
+    int _rbeActive = -1;           // Index of the resource entry of the write in progress
+    bool _rbeHeartbeatDue = false; // Whether the write in progress is a heartbeat
+    uint32_t _rbeValueHash = 0;    // Value hash of the write in progress
+    ReportStats _rbeStats = {};
+
+    // Server clock estimate (see: `now()`)
+    bool _clockValid = false;
+    unsigned long _clockRef = 0;    // `millis()` at the reference point
+    uint64_t _clockEpochMs = 0;     // Server time (epoch ms) at the reference point
+    unsigned long _clockError = 0;  // Estimated error (ms) at the reference point
+    unsigned long _clockMaxError = 2000;
+    unsigned long _clockDriftPpm = 100;
+
+    unsigned long _requestStart = 0; // Time (ms) the current request was sent
+    unsigned long _firstByte = 0;    // Time (ms) the first byte of the current response arrived
+    bool _responded = false;         // Whether the current request received a response (`_firstByte`)
+
+    // Read cache (see: `setReadCache()`)
+    ReadCacheEntry* _readCache = nullptr;
+    size_t _readCacheCount = 0;
+    ReadCacheStats _readCacheStats = {};
+
+    // Registered resources (see: `registerResource()`)
+    struct ResourceEntry {
+      char alias[EXO_RESOURCE_NAME_SIZE];
+      char encoded[EXO_RESOURCE_NAME_SIZE]; // URL-encoded alias, as sent
+      uint16_t encodedLen;                  // Length of the URL-encoded alias
+      uint32_t hash;                        // FNV-1a hash of the alias
+      ReadHandler handler;
+    };
+
+    ResourceEntry _resources[EXO_MAX_RESOURCES];
+    unsigned int _resourceCount = 0;
+
+    // Request pipeline state (see: `beginPipeline()`)
+    struct PipelineEntry {
+      const char* resource;
+      const char* value;    // Value of a write, or `nullptr` for a read
+      unsigned long start;  // Time (ms) the request was sent
+      bool sent;
+      bool answered;
+    };
+
+    PipelineEntry _pipeline[EXO_PIPELINE_DEPTH];
+    size_t _pipelineCount = 0;
+    bool _pipelineRetry = false;
+    bool _pipelineLost = false;   // Whether the connection was lost while sending
+
+    // Channel payload state (see: `beginChannels()`)
+    size_t _channelLen = 0;         // Length of the encoded payload in `_dataBuffer`
+    unsigned int _channelCount = 0;
+    bool _channelOverflow = false;
+
+    /**
+     * @brief Sets the domain (host) the internal `_client` will use for subsequent HTTP requests
+     *
+     * @param domain Domain name of the IoT Connector (e.g. "a5b9czkndm4g00000.m2.exosite.io")
+     */
+    void setDomain(const char* domain);
+
+    /**
+     * @brief Flushes the client connection buffer, clearing any incoming/outgoing data
+     */
+    void flushClient();
+
+    /**
+     * @brief Checks if the client is connected to the server
+     * 
+     * Note: If not, returns the result of an attempt to connect
+     *
+     * @return `true` if connected, `false` otherwise
+     */
+    bool isConnected();
+
+    /**
+     * @brief Updates a 32-bit FNV-1a hash with the provided data
+     *
+     * @param hash  Running hash value (start with `_fnvOffset`)
+     * @param data  Data to be hashed
+     * @param len   Length of the data
+     *
+     * @return Updated hash value
+     */
+    static uint32_t fnv1a(uint32_t hash, const char* data, size_t len);
+
+    static const uint32_t _fnvOffset = 2166136261UL;
+
+    /**
+     * @brief Hashes the value to be written, staging any deadband channel values
+     *
+     * Note: Flat JSON objects are hashed per key/value, otherwise the whole value is hashed
+     *
+     * @param value  Value to be written
+     */
+    void rbeStageValue(const char* value);
+
+    /**
+     * @brief Adds a single key/value pair (of a flat JSON object) to the value being staged
+     *
+     * @param key       Key of the pair (without quotes)
+     * @param keyLen    Length of the key
+     * @param value     Raw JSON value of the pair
+     * @param valueLen  Length of the raw value
+     */
+    void rbeStageField(const char* key, size_t keyLen, const char* value, size_t valueLen);
+
+    /**
+     * @brief Decides whether the staged value must be written to the specified resource
+     *
+     * @param resource  Target resource
+     *
+     * @return `true` if the value has changed (or the heartbeat is due), `false` to suppress it
+     */
+    bool rbeShouldSend(const char* resource);
+
+    /**
+     * @brief Records the staged value as the last value written (after a successful write)
+     */
+    void rbeCommit();
+
+    /**
+     * @brief Forgets the last value written to the specified resource (after a value is received)
+     *
+     * @param resource  Resource alias
+     */
+    void rbeForget(const char* resource);
+
+    /**
+     * @brief Opens the client connection if it is closed (without request tracking)
+     *
+     * @return `true` if connected, `false` otherwise
+     */
+    bool openConnection();
+
+    /**
+     * @brief Connects the client to the server (via the cached address, if a resolver is set)
+     *
+     * @return `true` if connected, `false` otherwise
+     */
+    bool connectClient();
+
+    /**
+     * @brief Returns the remaining time budget (ms) of the current API call
+     *
+     * @return Remaining budget (ms), or `ULONG_MAX` if no budget is set
+     */
+    unsigned long budgetRemaining();
+
+    /**
+     * @brief Determines whether the time budget of the current API call is exhausted
+     *
+     * @param phase  Name of the phase about to start (for logging)
+     *
+     * @return `true` if exhausted (and logged), `false` otherwise
+     */
+    bool budgetExpired(const char* phase);
+
+    /**
+     * @brief Determines whether the specified time interval has passed
+     *
+     * @param start     Start time (ms) (e.g. from `millis()`)
+     * @param duration  Duration (ms) to check against
+     *
+     * @return `true` if the time has expired, `false` otherwise
+     */
+    bool timeExpired(unsigned long start, unsigned long duration);
+
+    /**
+     * @brief Reads the full HTTP response from the server into a buffer
+     *
+     * @param destBuffer  Buffer in which to store the full HTTP response
+     * @param bufferSize  Size of the destination buffer
+     * @param timeoutMs   Timeout (ms) for awaiting/reading-in the response
+     *
+     * @return `true` if the response was read successfully, `false` on timeout or error
+     */
+    bool readHttpResponse(char* destBuffer, size_t bufferSize, unsigned long timeoutMs);
+
+    /**
+     * @brief Finds the read cache entry of a resource, counting the read as a miss (see: `cacheHit()`)
+     *
+     * @return Cache entry, or `nullptr` if the resource is not cached
+     */
+    ReadCacheEntry* cacheFind(const char* resource);
+
+    /**
+     * @brief Builds the conditional request header for a cached value (in `_pollHeaders`)
+     *
+     * @return Header, or `nullptr` if there is no cached value
+     */
+    const char* cacheCondition(ReadCacheEntry* entry);
+
+    /**
+     * @brief Stores a new value (received in `_dataBuffer`) in its cache entry (if any)
+     *
+     * @param entry  Cache entry (or `nullptr`)
+     * @param value  Decoded value
+     */
+    void cacheStore(ReadCacheEntry* entry, const char* value);
+
+    /**
+     * @brief Accounts for a `304 Not Modified` response to a conditional read
+     *
+     * @return Cached value, or `nullptr` (logged) if there is none
+     */
+    const char* cacheHit(ReadCacheEntry* entry);
+
+    /**
+     * @brief Retrieves the entry of a registered resource
+     *
+     * @param handle  Handle of the resource
+     *
+     * @return Resource entry, or `nullptr` (logged) if the handle is invalid
+     */
+    const ResourceEntry* resourceEntry(ResourceHandle handle);
+
+    /**
+     * @brief Reads a single HTTP response, framed by its `Content-Length`, into a buffer
+     *
+     * Note: Unlike `readHttpResponse()`, no bytes beyond the response are consumed
+     *
+     * @param buffer      Buffer in which to store the full HTTP response
+     * @param bufferSize  Size of the destination buffer
+     * @param timeoutMs   Timeout (ms) for awaiting/reading-in the response
+     *
+     * @return `true` if the response was read, `false` on timeout, error, or an unframed response
+     */
+    bool readFramedResponse(char* buffer, size_t bufferSize, unsigned long timeoutMs);
+
+    /**
+     * @brief Reads a single byte of a response, waiting for it to arrive
+     *
+     * @param startTime  Time (ms) at which reading of the response began
+     * @param timeoutMs  Timeout (ms) for reading the response
+     *
+     * @return The byte, or `-1` on timeout or if the connection was closed
+     */
+    int readResponseByte(unsigned long startTime, unsigned long timeoutMs);
+
+    /**
+     * @brief Records the usage of a buffer, updating its high-water mark and near-miss count
+     *
+     * @param highWater  High-water mark to be updated
+     * @param used       Length used (excluding the null terminator)
+     * @param capacity   Usable length of the buffer (`0` if unbounded, e.g. `String`)
+     */
+    void trackUsage(size_t& highWater, size_t used, size_t capacity);
+
+    /**
+     * @brief Records the header and body lengths of a received HTTP response
+     *
+     * @param buffer      Buffer holding the full HTTP response
+     * @param bufferSize  Size of the buffer
+     * @param length      Length of the HTTP response
+     */
+    void trackResponse(const char* buffer, size_t bufferSize, size_t length);
+
+    /**
+     * @brief Decompresses (in place) the body of a received HTTP response, if compressed
+     *
+     * @param buffer      Buffer holding the full HTTP response
+     * @param bufferSize  Size of the buffer
+     * @param length      Length of the HTTP response (the body may contain null bytes)
+     *
+     * @return `true` if not compressed or successfully decompressed, `false` otherwise
+     */
+    bool decodeContent(char* buffer, size_t bufferSize, size_t length);
+
+    /**
+     * @brief Decodes the value of a `resource=value` response body in place, in the internal buffer
+     *
+     * @param value  View of the decoded value
+     *
+     * @return `true` if successful, `false` otherwise (logged)
+     */
+    bool decodeBodyInPlace(ValueView& value);
+
+    /**
+     * @brief `DeflateSink` writing compressed output to the client
+     *
+     * @param data     Compressed data
+     * @param len      Length of the data
+     * @param context  Target `Client`
+     */
+    static void clientSink(const uint8_t* data, size_t len, void* context);
+
+    /**
+     * @brief Samples the server clock from the `Date` header of a received HTTP response
+     *
+     * @param response  Null-terminated HTTP response
+     */
+    void clockSampleDate(const char* response);
+
+    /**
+     * @brief Checks the connection for the latest pipeline entry (opening it for the first entry)
+     *
+     * @return `true` if the request can be sent on the pipeline's connection, `false` otherwise
+     */
+    bool pipelineConnected();
+
+    /**
+     * @brief Sends the request of a pipeline entry
+     *
+     * @param entry  Pipeline entry
+     *
+     * @return `true` if sent, `false` otherwise
+     */
+    bool pipelineSend(PipelineEntry& entry);
+
+    /**
+     * @brief Processes the response (in `_dataBuffer`) to the request of a pipeline entry
+     *
+     * @param entry   Pipeline entry
+     * @param onRead  (Optional) Callback receiving the decoded value of a read resource
+     *
+     * @return Result of the request
+     */
+    ApiResponse pipelineResult(const PipelineEntry& entry, ReadHandler onRead);
+
+    /**
+     * @brief Finds the value of the specified header in a received HTTP response
+     *
+     * @param response  Null-terminated HTTP response (headers + body)
+     * @param name      Header name, without the colon (case-insensitive)
+     *
+     * @return Pointer to the header value (within `response`), or `nullptr` if not found
+     */
+    static const char* findHeader(const char* response, const char* name);
+
+    /**
+     * @brief Parses an HTTP date (e.g. `Sun, 18 Oct 2026 12:00:00 GMT`)
+     *
+     * @param date   HTTP date (IMF-fixdate)
+     * @param epoch  Parsed time (epoch seconds)
+     *
+     * @return `true` if parsed, `false` otherwise
+     */
+    static bool parseHttpDate(const char* date, unsigned long* epoch);
+
+    /**
+     * @brief Moves the clock reference point forward, so `millis()` wraparound is never reached
+     */
+    void clockAdvance();
+
+    /**
+     * @brief Returns the estimated error (ms) of the server clock estimate
+     */
+    unsigned long clockError();
+
+    /**
+     * @brief Updates the server clock estimate with a (1 s resolution) server time sample
+     *
+     * Note: The sample is assumed taken at the midpoint between `_requestStart` and `_firstByte`
+     *
+     * @param serverTime  Server time (epoch seconds)
+     */
+    void clockSample(unsigned long serverTime);
+
+    /**
+     * @brief Sends an HTTP GET request to the specified path
+     *
+     * @param path          API endpoint
+     * @param resource      (Optional) Resource alias to be queried
+     * @param authToken     (Optional) Client auth token
+     * @param extraHeaders  (Optional) Additional headers to be included (e.g. for `longPoll()`)
+     *
+     * @return `true` if sent, `false` if the time budget was exhausted (closing the connection)
+     */
+    bool sendGetRequest(const char* path,
+                        const char* resource=nullptr, const char* authToken=nullptr, const char* extraHeaders=nullptr);
+
+    /**
+     * @brief Sends an HTTP POST request to the specified path, with a single key/value pair in the body
+     *
+     * @param path       API endpoint
+     * @param key        Key to send in the POST body
+     * @param keyLen     Length of the key
+     * @param value      Value to associate with the key in the POST body
+     * @param authToken  (Optional) Client auth token
+     *
+     * @return `true` if sent, `false` if the time budget was exhausted before the headers or the
+     *         body (closing the connection)
+     */
+    bool sendPostRequest(const char* path, const char* key, size_t keyLen, const char* value,
+                         const char* authToken=nullptr);
+
+    /**
+     * @brief Constructs HTTP headers for a Long Poll request (`Last-Modified` and `Request-Timeout`)
+     *
+     * @param buffer         Buffer in which to store the headers
+     * @param bufferSize     Size of the destination buffer
+     * @param lastModified   Timestamp (ms) for the `Last-Modified` header
+     * @param pollTimeoutMs  Timeout (ms) for the `Request-Timeout` header
+     */
+    void buildPollHeaders(char* buffer, size_t bufferSize, unsigned long lastModified, unsigned long pollTimeoutMs);
+
+    /**
+     * @brief Sends the URL-encoded value held in `_dataBuffer` to the specified resource
+     *
+     * Note: Assumes the client is connected
+     *
+     * @param resource     Target resource (URL-encoded)
+     * @param resourceLen  Length of the resource
+     *
+     * @return `true` if successful (HTTP 204), `false` otherwise
+     */
+    ApiResponse writeEncoded(const char* resource, size_t resourceLen);
+
+    /**
+     * @brief Writes a value to the specified resource (see: `write()`)
+     *
+     * @param alias        Resource alias (as tracked by report-by-exception)
+     * @param resource     Target resource, as sent (e.g. URL-encoded, as registered)
+     * @param resourceLen  Length of the target resource
+     * @param writeChars   Value to be written
+     *
+     * @return `true` if successful (HTTP 204) or suppressed by report-by-exception (`304`), `false` otherwise
+     */
+    ApiResponse writeAlias(const char* alias, const char* resource, size_t resourceLen, const char* writeChars);
+
+    /**
+     * @brief Writes the channel payload to the specified resource (see: `writeChannels()`)
+     *
+     * @param alias        Resource alias (as tracked by report-by-exception)
+     * @param resource     Target resource, as sent (e.g. URL-encoded, as registered)
+     * @param resourceLen  Length of the target resource
+     *
+     * @return `true` if successful (HTTP 204) or suppressed by report-by-exception (`304`), `false` otherwise
+     */
+    ApiResponse writeChannelsAlias(const char* alias, const char* resource, size_t resourceLen);
+
+    /**
+     * @brief Reads the value of the specified resource (see: `read()`)
+     *
+     * @param alias           Resource alias (as looked up in the read cache)
+     * @param resource        Target resource, as sent (e.g. URL-encoded, as registered)
+     * @param responseBuffer  Buffer in which to store the decoded value
+     * @param bufferSize      Size of the destination buffer
+     *
+     * @return `true` if successful (HTTP 200, 204, or 304), `false` otherwise
+     */
+    ApiResponse readAlias(const char* alias, const char* resource, char* responseBuffer, size_t bufferSize);
+
+    /**
+     * @brief Long polls the specified resource (see: `longPoll()`)
+     *
+     * @param alias           Resource alias
+     * @param resource        Target resource, as sent (e.g. URL-encoded, as registered)
+     * @param responseBuffer  Buffer in which to store the decoded value
+     * @param bufferSize      Size of the destination buffer
+     * @param lastModified    Epoch timestamp (seconds) of the last known update
+     * @param pollTimeout     Polling timeout in milliseconds
+     *
+     * @return `true` if new data or pollTimeout reached (HTTP 200 or 304), `false` otherwise
+     */
+    ApiResponse longPollAlias(const char* alias, const char* resource, char* responseBuffer, size_t bufferSize,
+                              unsigned long lastModified, unsigned long pollTimeout);
+
+    /**
+     * @brief Appends a single raw `"channel":value` pair to the channel payload in `_dataBuffer`
+     *
+     * @param channel   Channel key
+     * @param value     Raw JSON value (e.g. `2.41`)
+     * @param valueLen  Length of the raw value
+     *
+     * @return `true` if appended, `false` if the internal buffer is full
+     */
+    bool appendChannel(const char* channel, const char* value, size_t valueLen);
+
+    /**
+     * @brief URL-encodes the provided data, appending it to the channel payload in `_dataBuffer`
+     *
+     * @param src  Data to be encoded
+     * @param len  Length of the data
+     *
+     * @return `true` if appended, `false` if the internal buffer is full
+     */
+    bool appendEncoded(const char* src, size_t len);
+
+    /**
+     * @brief URL-encodes a single character
+     *
+     * @param c         Character to be encoded
+     * @param dest      Buffer in which to store the encoded character (>= 3 bytes)
+     * @param encoding  URL-encoding profile (e.g. `_encoding`)
+     *
+     * @return Length of the encoded character (1 or 3)
+     */
+    size_t encodeChar(char c, char* dest, UrlEncoding encoding);
+
+    /**
+     * @brief URL-encodes a value into the destination buffer
+     *
+     * @param src       Source value to be encoded
+     * @param dest      Buffer in which to store the encoded value
+     * @param destSize  Size of the destination buffer
+     * @param encoding  URL-encoding profile (e.g. `_encoding`)
+     *
+     * @return `true` if encoding was successful, `false` on error or (e.g. insufficient buffer)
+     */
+    bool urlEncode(const char* src, char* dest, size_t destSize, UrlEncoding encoding);
+
+    /**
+     * @brief URL-decodes an encoded value into a buffer
+     *
+     * @param src       Source value to be decoded
+     * @param dest      Buffer in which to store the decoded value
+     * @param destSize  Size of the destination buffer
+     *
+     * @return `true` if the decoding was successful, `false` on error or (e.g. insufficient buffer)
+     */
+    bool urlDecode(const char* src, char* dest, size_t destSize);
+
+#ifndef EXO_NO_HEAP
+    /**
+     * @brief URL-decodes an encoded value into a buffer
      *
      * @param src       Source value to be decoded
      * @param dest      Buffer in which to store the decoded value
@@ -436,4 +1659,5 @@ class ExositeHTTP {
      * @return `true` if the decoding was successful, `false` on error or (e.g. insufficient buffer)
      */
     bool urlDecode(const String& input, String& responseString);
+#endif
 };
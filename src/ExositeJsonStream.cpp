@@ -0,0 +1,361 @@
+//************************************************************************************************
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Exosite
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//************************************************************************************************
+
+#include "ExositeJsonStream.h"
+
+static bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static bool isDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+// JSON number grammar: `-? (0 | [1-9][0-9]*) (. [0-9]+)? ([eE] [+-]? [0-9]+)?`
+static bool isNumber(const char* s) {
+  if (*s == '-') s++;
+
+  if (*s == '0') s++;
+  else if (isDigit(*s)) while (isDigit(*s)) s++;
+  else return false;
+
+  if (*s == '.') {
+    s++;
+    if (!isDigit(*s)) return false;
+    while (isDigit(*s)) s++;
+  }
+
+  if (*s == 'e' || *s == 'E') {
+    s++;
+    if (*s == '+' || *s == '-') s++;
+    if (!isDigit(*s)) return false;
+    while (isDigit(*s)) s++;
+  }
+
+  return *s == '\0';
+}
+
+ExositeJsonStream::ExositeJsonStream(JsonHandler handler, void* context) : _handler(handler), _context(context) {
+  reset();
+}
+
+void ExositeJsonStream::reset() {
+  _state = STATE_VALUE;
+  _isKey = false;
+  _depth = 0;
+  _arrays = 0;
+  _index[0] = 0;
+  _pathBase[0] = 0;
+  _path[0] = '\0';
+  _pathLen = 0;
+  _valueLen = 0;
+  _truncated = false;
+}
+
+bool ExositeJsonStream::error() {
+  return _state == STATE_ERROR;
+}
+
+unsigned long ExositeJsonStream::truncations() {
+  return _truncations;
+}
+
+void ExositeJsonStream::sink(const char* data, size_t len, void* context) {
+  ((ExositeJsonStream*)context)->feed(data, len);
+}
+
+bool ExositeJsonStream::feed(const char* data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    if (!feed(data[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ExositeJsonStream::feed(char c) {
+  switch (_state) {
+    case STATE_VALUE:
+      if (isSpace(c)) return true;
+      return beginValue(c);
+
+    case STATE_ARRAY_FIRST:
+      if (isSpace(c)) return true;
+      if (c == ']') {
+        _depth--;
+        return endValue();
+      }
+      return beginValue(c);
+
+    case STATE_KEY_FIRST:
+    case STATE_KEY:
+      if (isSpace(c)) return true;
+      if (c == '}' && _state == STATE_KEY_FIRST) {
+        _depth--;
+        return endValue();
+      }
+      if (c != '"') return fail();
+      beginString();
+      _isKey = true;
+      return true;
+
+    case STATE_COLON:
+      if (isSpace(c)) return true;
+      if (c != ':') return fail();
+      _state = STATE_VALUE;
+      return true;
+
+    case STATE_NEXT:
+      if (isSpace(c)) return true;
+      if (_depth == 0) return fail();
+      if (c == ',') {
+        if (isArray()) {
+          _index[_depth]++;
+          _state = STATE_VALUE;
+        }
+        else {
+          _state = STATE_KEY;
+        }
+        return true;
+      }
+      if (c == (isArray() ? ']' : '}')) {
+        _depth--;
+        return endValue();
+      }
+      return fail();
+
+    case STATE_STRING:
+      if (c == '"') {
+        _value[_valueLen] = '\0';
+        if (_isKey) {
+          _isKey = false;
+          _state = STATE_COLON;
+          return appendPath(_value, _valueLen);
+        }
+        _handler(_path, _value, JSON_STRING, _context);
+        return endValue();
+      }
+      if (c == '\\') {
+        _state = STATE_ESCAPE;
+        return true;
+      }
+      if ((uint8_t)c < 0x20) return fail();
+      appendValue(c);
+      return true;
+
+    case STATE_ESCAPE:
+      _state = STATE_STRING;
+      switch (c) {
+        case '"': case '\\': case '/': appendValue(c); return true;
+        case 'b': appendValue('\b'); return true;
+        case 'f': appendValue('\f'); return true;
+        case 'n': appendValue('\n'); return true;
+        case 'r': appendValue('\r'); return true;
+        case 't': appendValue('\t'); return true;
+        case 'u':
+          _unicode = 0;
+          _unicodeDigits = 0;
+          _state = STATE_UNICODE;
+          return true;
+        default:
+          return fail();
+      }
+
+    case STATE_UNICODE: {
+      uint8_t digit;
+      if (c >= '0' && c <= '9') digit = c - '0';
+      else if (c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+      else if (c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+      else return fail();
+
+      _unicode = (_unicode << 4) | digit;
+      if (++_unicodeDigits < 4) return true;
+
+      // Encode as UTF-8 (surrogate pairs are not combined, and are replaced by `?`)
+      if (_unicode < 0x80) {
+        appendValue(_unicode);
+      }
+      else if (_unicode < 0x800) {
+        appendValue(0xC0 | (_unicode >> 6));
+        appendValue(0x80 | (_unicode & 0x3F));
+      }
+      else if (_unicode >= 0xD800 && _unicode <= 0xDFFF) {
+        appendValue('?');
+      }
+      else {
+        appendValue(0xE0 | (_unicode >> 12));
+        appendValue(0x80 | ((_unicode >> 6) & 0x3F));
+        appendValue(0x80 | (_unicode & 0x3F));
+      }
+      _state = STATE_STRING;
+      return true;
+    }
+
+    case STATE_LITERAL:
+      if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || c == '.' || c == '-' || c == '+' || c == 'E') {
+        appendValue(c);
+        return true;
+      }
+      // The literal ends at the first other character, which is then processed as usual
+      return emitLiteral() && feed(c);
+
+    case STATE_DONE:
+      return isSpace(c) ? true : fail();
+
+    default:
+      return false;
+  }
+}
+
+bool ExositeJsonStream::finish() {
+  if (_state == STATE_LITERAL && _depth == 0) {
+    emitLiteral();
+  }
+  return _state == STATE_DONE;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+bool ExositeJsonStream::fail() {
+  _state = STATE_ERROR;
+  return false;
+}
+
+bool ExositeJsonStream::beginValue(char c) {
+  // Array elements are addressed by index (object members already appended their key)
+  if (_depth > 0 && isArray()) {
+    char index[6];
+    snprintf(index, sizeof(index), "%u", (unsigned int)_index[_depth]);
+    if (!appendPath(index, strlen(index))) {
+      return false;
+    }
+  }
+
+  _valueLen = 0;
+  _truncated = false;
+
+  if (c == '{' || c == '[') {
+    if (_depth >= EXO_JSON_MAX_DEPTH) {
+      return fail();
+    }
+    _depth++;
+    _pathBase[_depth] = _pathLen;
+    _index[_depth] = 0;
+
+    if (c == '[') {
+      _arrays |= (1U << _depth);
+      _state = STATE_ARRAY_FIRST;
+    }
+    else {
+      _arrays &= ~(1U << _depth);
+      _state = STATE_KEY_FIRST;
+    }
+    return true;
+  }
+
+  if (c == '"') {
+    beginString();
+    return true;
+  }
+
+  if ((c >= '0' && c <= '9') || c == '-' || c == 't' || c == 'f' || c == 'n') {
+    appendValue(c);
+    _state = STATE_LITERAL;
+    return true;
+  }
+
+  return fail();
+}
+
+bool ExositeJsonStream::endValue() {
+  // Remove the path component of the completed value
+  _pathLen = _pathBase[_depth];
+  _path[_pathLen] = '\0';
+
+  _state = _depth == 0 ? STATE_DONE : STATE_NEXT;
+  return true;
+}
+
+bool ExositeJsonStream::appendPath(const char* component, size_t len) {
+  size_t separator = _pathLen > 0 ? 1 : 0;
+  if (_pathLen + separator + len >= sizeof(_path)) {
+    return fail();
+  }
+
+  if (separator) {
+    _path[_pathLen++] = '.';
+  }
+  memcpy(_path + _pathLen, component, len);
+  _pathLen += len;
+  _path[_pathLen] = '\0';
+  return true;
+}
+
+void ExositeJsonStream::beginString() {
+  _isKey = false;
+  _valueLen = 0;
+  _truncated = false;
+  _state = STATE_STRING;
+}
+
+void ExositeJsonStream::appendValue(char c) {
+  if (_valueLen < sizeof(_value) - 1) {
+    _value[_valueLen++] = c;
+  }
+  else if (!_truncated) {
+    _truncated = true; // Count each truncated value once
+    _truncations++;
+  }
+}
+
+bool ExositeJsonStream::emitLiteral() {
+  if (_truncated) {
+    return fail(); // Truncated literals cannot be valid
+  }
+  _value[_valueLen] = '\0';
+
+  JsonValueType type;
+  if (strcmp(_value, "true") == 0 || strcmp(_value, "false") == 0) {
+    type = JSON_BOOL;
+  }
+  else if (strcmp(_value, "null") == 0) {
+    type = JSON_NULL;
+  }
+  else if (isNumber(_value)) {
+    type = JSON_NUMBER;
+  }
+  else {
+    return fail();
+  }
+
+  _handler(_path, _value, type, _context);
+  return endValue();
+}
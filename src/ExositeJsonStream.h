@@ -0,0 +1,209 @@
+//************************************************************************************************
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Exosite
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Optional Overrides
+
+// Max nesting depth, path length, and value length of a streamed document (uncomment to override)
+// #define EXO_JSON_MAX_DEPTH 8
+// #define EXO_JSON_PATH_SIZE 96
+// #define EXO_JSON_VALUE_SIZE 64
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+#ifndef EXO_JSON_MAX_DEPTH
+  #define EXO_JSON_MAX_DEPTH 8
+#endif
+
+#ifndef EXO_JSON_PATH_SIZE
+  #define EXO_JSON_PATH_SIZE 96
+#endif
+
+#ifndef EXO_JSON_VALUE_SIZE
+  #define EXO_JSON_VALUE_SIZE 64
+#endif
+
+// Limits of the compact parser state (a bit per depth, and one byte per path length)
+#if EXO_JSON_MAX_DEPTH > 15
+  #error "EXO_JSON_MAX_DEPTH must be at most 15"
+#endif
+#if EXO_JSON_PATH_SIZE > 256
+  #error "EXO_JSON_PATH_SIZE must be at most 256"
+#endif
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Types of values reported by `ExositeJsonStream`
+ */
+enum JsonValueType {
+  JSON_STRING,
+  JSON_NUMBER,
+  JSON_BOOL,
+  JSON_NULL
+};
+
+/**
+ * @brief Callback receiving each scalar value of a streamed document
+ *
+ * Note: `path` and `value` are only valid for the duration of the call
+ *
+ * @param path     Path of the value, with object keys and array indexes joined by `.` (e.g.
+ *                 `channels.001.protocol_config.report_rate`)
+ * @param value    Value (unquoted and unescaped for strings; e.g. `true`, `10000`, `V`)
+ * @param type     Type of the value
+ * @param context  Context pointer provided to `ExositeJsonStream`
+ */
+typedef void (*JsonHandler)(const char* path, const char* value, JsonValueType type, void* context);
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Streaming JSON tokenizer, reporting each value with its path as the document is fed
+ *
+ * Note:
+ *
+ * - Uses a small fixed state (see: `EXO_JSON_MAX_DEPTH`, `EXO_JSON_PATH_SIZE`,
+ *   `EXO_JSON_VALUE_SIZE`), so documents of any length can be processed in constant memory
+ *
+ * - Longer values are truncated (and counted, see: `truncations()`); deeper nesting or longer
+ *   paths stop the document with an error
+ *
+ * - Example: `exosite.readStream("config_io", ExositeJsonStream::sink, &parser);`
+ */
+class ExositeJsonStream {
+  public:
+    /**
+     * @brief Create a tokenizer
+     *
+     * @param handler  Callback receiving each value
+     * @param context  (Optional) Context pointer passed to the handler
+     */
+    ExositeJsonStream(JsonHandler handler, void* context=nullptr);
+
+    /**
+     * @brief Feed a single character of the document
+     *
+     * @return `true` if accepted, `false` if the document is invalid (see: `error()`)
+     */
+    bool feed(char c);
+
+    /**
+     * @brief Feed part of the document
+     *
+     * @param data  Part of the document
+     * @param len   Length of the part
+     *
+     * @return `true` if accepted, `false` if the document is invalid (see: `error()`)
+     */
+    bool feed(const char* data, size_t len);
+
+    /**
+     * @brief Complete the document
+     *
+     * @return `true` if a complete and valid document was fed, `false` otherwise
+     */
+    bool finish();
+
+    /**
+     * @brief Reset the tokenizer for a new document
+     */
+    void reset();
+
+    /**
+     * @brief Check whether the document fed so far is invalid
+     */
+    bool error();
+
+    /**
+     * @brief Retrieve the number of values truncated to `EXO_JSON_VALUE_SIZE - 1` characters
+     */
+    unsigned long truncations();
+
+    /**
+     * @brief Feeds data to a tokenizer (for use as an `ExositeHTTP::readStream()` sink)
+     *
+     * @param data     Part of the document
+     * @param len      Length of the part
+     * @param context  Tokenizer (`ExositeJsonStream*`)
+     */
+    static void sink(const char* data, size_t len, void* context);
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  private:
+    enum State : uint8_t {
+      STATE_VALUE,        // expecting a value
+      STATE_ARRAY_FIRST,  // expecting a value or `]` (after `[`)
+      STATE_KEY_FIRST,    // expecting a key or `}` (after `{`)
+      STATE_KEY,          // expecting a key (after `,`)
+      STATE_COLON,        // expecting `:`
+      STATE_NEXT,         // expecting `,` or the end of the container
+      STATE_STRING,
+      STATE_ESCAPE,
+      STATE_UNICODE,
+      STATE_LITERAL,      // number, `true`, `false`, or `null`
+      STATE_DONE,
+      STATE_ERROR
+    };
+
+    JsonHandler _handler;
+    void* _context;
+
+    State _state;
+    bool _isKey;                 // Whether the string being read is an object key
+    uint8_t _depth;
+    uint16_t _arrays;            // Bit per depth (1 to 15): set for arrays, clear for objects
+    uint16_t _index[EXO_JSON_MAX_DEPTH + 1];
+    uint8_t _pathBase[EXO_JSON_MAX_DEPTH + 1]; // Path length of each container (up to 255)
+
+    char _path[EXO_JSON_PATH_SIZE];
+    size_t _pathLen;
+    char _value[EXO_JSON_VALUE_SIZE];
+    size_t _valueLen;            // Characters kept (at most `EXO_JSON_VALUE_SIZE - 1`)
+    bool _truncated;             // Whether characters of the current value were dropped
+    uint16_t _unicode;           // Code point of a `\u` escape being read
+    uint8_t _unicodeDigits;
+    unsigned long _truncations = 0;
+
+    bool fail();
+    bool beginValue(char c);
+    bool endValue();
+    bool appendPath(const char* component, size_t len);
+    void beginString();
+    void appendValue(char c);
+    bool emitLiteral();
+    bool isArray() { return (_arrays >> _depth) & 1; }
+};
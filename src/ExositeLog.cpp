@@ -0,0 +1,240 @@
+//************************************************************************************************
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Exosite
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//************************************************************************************************
+
+#include "ExositeHTTP.h" // Includes "ExositeLog.h" (after the optional overrides)
+
+uint8_t ExositeLog::_level = EXO_LOG_LEVEL;
+Print* ExositeLog::_output = &Serial;
+bool ExositeLog::_deferred = false;
+
+#if EXO_LOG_RING_SIZE > 0
+// Record layout: level (1), argument count (1), line (2), then per argument its type (1) and:
+//   FLASH: pointer, TEXT: length (1) + bytes, INT/UINT/FLOAT: 4 bytes
+static uint8_t _ring[EXO_LOG_RING_SIZE];
+static size_t _head = 0; // Next byte written
+static size_t _tail = 0; // Next byte read
+static size_t _used = 0;
+static unsigned long _dropped = 0;
+
+static void ringPut(const void* data, size_t len) {
+  const uint8_t* bytes = (const uint8_t*)data;
+  for (size_t i = 0; i < len; i++) {
+    _ring[_head] = bytes[i];
+    _head = (_head + 1) % EXO_LOG_RING_SIZE;
+  }
+  _used += len;
+}
+
+static void ringGet(void* data, size_t len) {
+  uint8_t* bytes = (uint8_t*)data;
+  for (size_t i = 0; i < len; i++) {
+    bytes[i] = _ring[_tail];
+    _tail = (_tail + 1) % EXO_LOG_RING_SIZE;
+  }
+  _used -= len;
+}
+#endif
+
+void ExositeLog::setOutput(Print* output) {
+  _output = output;
+}
+
+void ExositeLog::setLevel(uint8_t level) {
+  _level = level < EXO_LOG_LEVEL ? level : EXO_LOG_LEVEL;
+}
+
+void ExositeLog::setDeferred(bool enabled) {
+  if (!enabled) {
+    drain();
+  }
+  _deferred = enabled && EXO_LOG_RING_SIZE > 0;
+}
+
+size_t ExositeLog::pending() {
+#if EXO_LOG_RING_SIZE > 0
+  return _used;
+#else
+  return 0;
+#endif
+}
+
+void ExositeLog::write(uint8_t level, uint16_t line, const ExoLogArg* args, size_t count) {
+  if (!_deferred) {
+    if (!_output || (_output == &Serial && !Serial)) {
+      return;
+    }
+
+    printPrefix(level, line);
+    for (size_t i = 0; i < count; i++) {
+      printArg(args[i]);
+    }
+    _output->println();
+    return;
+  }
+
+#if EXO_LOG_RING_SIZE > 0
+  if (count > 255) {
+    count = 255;
+  }
+
+  // Measure the record, so it is either stored whole or dropped
+  size_t len = 4;
+  for (size_t i = 0; i < count; i++) {
+    if (args[i].type == ExoLogArg::FLASH) {
+      len += 1 + sizeof(const void*);
+    } else if (args[i].type == ExoLogArg::TEXT) {
+      size_t textLen = strlen((const char*)args[i].value.ptr);
+      len += 2 + (textLen < EXO_LOG_MAX_STRING ? textLen : EXO_LOG_MAX_STRING);
+    } else {
+      len += 5;
+    }
+  }
+
+  if (len > EXO_LOG_RING_SIZE - _used) {
+    _dropped++;
+    return;
+  }
+
+  uint8_t header[4] = {level, (uint8_t)count, (uint8_t)(line & 0xFF), (uint8_t)(line >> 8)};
+  ringPut(header, sizeof(header));
+
+  for (size_t i = 0; i < count; i++) {
+    const ExoLogArg& arg = args[i];
+    uint8_t type = arg.type;
+    ringPut(&type, 1);
+
+    if (arg.type == ExoLogArg::FLASH) {
+      ringPut(&arg.value.ptr, sizeof(const void*));
+    } else if (arg.type == ExoLogArg::TEXT) {
+      size_t textLen = strlen((const char*)arg.value.ptr);
+      uint8_t stored = textLen < EXO_LOG_MAX_STRING ? textLen : EXO_LOG_MAX_STRING;
+      ringPut(&stored, 1);
+      ringPut(arg.value.ptr, stored);
+    } else {
+      uint32_t raw;
+      if (arg.type == ExoLogArg::FLOAT) {
+        memcpy(&raw, &arg.value.f, sizeof(raw));
+      } else if (arg.type == ExoLogArg::INT) {
+        raw = (uint32_t)(int32_t)arg.value.i;
+      } else {
+        raw = (uint32_t)arg.value.u;
+      }
+      ringPut(&raw, sizeof(raw));
+    }
+  }
+#endif
+}
+
+size_t ExositeLog::drain(size_t maxRecords) {
+  size_t printed = 0;
+
+#if EXO_LOG_RING_SIZE > 0
+  if (!_output || (_output == &Serial && !Serial)) {
+    return 0;
+  }
+
+  if (_dropped > 0) {
+    _output->print(G("WARN (log) Records dropped: "));
+    _output->println(_dropped);
+    _dropped = 0;
+  }
+
+  while (_used > 0 && (maxRecords == 0 || printed < maxRecords)) {
+    uint8_t header[4];
+    ringGet(header, sizeof(header));
+    printPrefix(header[0], header[2] | (header[3] << 8));
+
+    for (uint8_t i = 0; i < header[1]; i++) {
+      uint8_t type;
+      ringGet(&type, 1);
+
+      if (type == ExoLogArg::FLASH) {
+        const void* ptr;
+        ringGet(&ptr, sizeof(ptr));
+        printArg(ExoLogArg((const __FlashStringHelper*)ptr));
+      } else if (type == ExoLogArg::TEXT) {
+        char text[EXO_LOG_MAX_STRING + 1];
+        uint8_t textLen;
+        ringGet(&textLen, 1);
+        ringGet(text, textLen);
+        text[textLen] = '\0';
+        _output->print(text);
+      } else {
+        uint32_t raw;
+        ringGet(&raw, sizeof(raw));
+
+        if (type == ExoLogArg::FLOAT) {
+          float value;
+          memcpy(&value, &raw, sizeof(value));
+          _output->print(value);
+        } else if (type == ExoLogArg::INT) {
+          _output->print((long)(int32_t)raw);
+        } else {
+          _output->print((unsigned long)raw);
+        }
+      }
+    }
+
+    _output->println();
+    printed++;
+  }
+#endif
+
+  return printed;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void ExositeLog::printPrefix(uint8_t level, uint16_t line) {
+  _output->print(level == EXO_LOG_LEVEL_ERROR ? G("ERROR (line:") : G("DEBUG (line:"));
+  _output->print((unsigned int)line);
+  _output->print(G(") "));
+}
+
+void ExositeLog::printArg(const ExoLogArg& arg) {
+  switch (arg.type) {
+    case ExoLogArg::FLASH:
+      _output->print((const __FlashStringHelper*)arg.value.ptr);
+      break;
+    case ExoLogArg::TEXT:
+      _output->print((const char*)arg.value.ptr);
+      break;
+    case ExoLogArg::INT:
+      _output->print(arg.value.i);
+      break;
+    case ExoLogArg::UINT:
+      _output->print(arg.value.u);
+      break;
+    case ExoLogArg::FLOAT:
+      _output->print(arg.value.f);
+      break;
+  }
+}
@@ -0,0 +1,221 @@
+//************************************************************************************************
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Exosite
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Optional Overrides
+
+// Log levels compiled in: 0 (none), 1 (errors), 2 (errors and debug) (uncomment to override)
+// #define EXO_LOG_LEVEL 1
+
+// Size of the deferred log ring in bytes, or 0 to always print synchronously (uncomment to override)
+// #define EXO_LOG_RING_SIZE 256
+
+// Max length of a string argument kept in the deferred log ring (uncomment to override)
+// #define EXO_LOG_MAX_STRING 48
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+#define EXO_LOG_LEVEL_NONE  0
+#define EXO_LOG_LEVEL_ERROR 1
+#define EXO_LOG_LEVEL_DEBUG 2
+
+#ifndef EXO_LOG_LEVEL
+  #ifdef EXO_DEBUG_LOGGING
+    #define EXO_LOG_LEVEL EXO_LOG_LEVEL_DEBUG
+  #else
+    #define EXO_LOG_LEVEL EXO_LOG_LEVEL_ERROR
+  #endif
+#endif
+
+#ifndef EXO_LOG_RING_SIZE
+  #define EXO_LOG_RING_SIZE 256
+#endif
+
+#ifndef EXO_LOG_MAX_STRING
+  #define EXO_LOG_MAX_STRING 48
+#endif
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Single argument of a log record (converted implicitly from the supported types)
+ */
+class ExoLogArg {
+  public:
+    enum Type : uint8_t { FLASH, TEXT, INT, UINT, FLOAT };
+
+    ExoLogArg(const __FlashStringHelper* value) : type(FLASH) { this->value.ptr = value; }
+    ExoLogArg(const char* value) : type(TEXT) { this->value.ptr = value ? value : ""; }
+    ExoLogArg(const String& value) : type(TEXT) { this->value.ptr = value.c_str(); }
+    ExoLogArg(int value) : type(INT) { this->value.i = value; }
+    ExoLogArg(long value) : type(INT) { this->value.i = value; }
+    ExoLogArg(unsigned int value) : type(UINT) { this->value.u = value; }
+    ExoLogArg(unsigned long value) : type(UINT) { this->value.u = value; }
+    ExoLogArg(double value) : type(FLOAT) { this->value.f = value; }
+
+    Type type;
+    union {
+      const void* ptr;
+      long i;
+      unsigned long u;
+      float f;
+    } value;
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Library log backend (used by `LOG_ERROR()` and `LOG_DEBUG()`)
+ *
+ * Note:
+ *
+ * - By default, records are printed synchronously to `Serial` (e.g. `ERROR (line:42) ...`)
+ *
+ * - In deferred mode, records are instead stored as compact binary records (level, line, and
+ *   arguments) in a fixed RAM ring (see: `EXO_LOG_RING_SIZE`), and printed by `drain()` (e.g.
+ *   when idle), so logging no longer stalls requests on a slow output
+ *
+ * - Flash strings are kept by reference, while RAM strings are copied (up to
+ *   `EXO_LOG_MAX_STRING` bytes); records that do not fit in the ring are dropped (and counted)
+ *
+ * - Levels above `EXO_LOG_LEVEL` are removed at compile time, and `setLevel()` further
+ *   filters the remaining levels at runtime
+ *
+ * - The ring is not synchronised: in deferred mode, records must be logged and drained from a
+ *   single thread (e.g. with an `ExositeWorker`, the network thread only, which also means the
+ *   application thread must not call `drain()` or log through the library)
+ */
+class ExositeLog {
+  public:
+    /**
+     * @brief Set the output to which records are printed (e.g. `Serial`, or `nullptr` to discard)
+     *
+     * @param output  Output stream (default: `Serial`)
+     */
+    static void setOutput(Print* output);
+
+    /**
+     * @brief Set the highest level recorded at runtime (up to `EXO_LOG_LEVEL`)
+     *
+     * @param level  `EXO_LOG_LEVEL_NONE`, `EXO_LOG_LEVEL_ERROR`, or `EXO_LOG_LEVEL_DEBUG`
+     */
+    static void setLevel(uint8_t level);
+
+    /**
+     * @brief Enable or disable deferred logging (see: `drain()`)
+     *
+     * Note: Disabling deferred logging prints any pending records first
+     *
+     * @param enabled  `true` to store records in the ring, `false` to print them synchronously (default)
+     */
+    static void setDeferred(bool enabled);
+
+    /**
+     * @brief Print pending records to the output (e.g. when idle)
+     *
+     * Note: Must be called from the thread that logs (see: class notes)
+     *
+     * @param maxRecords  (Optional) Max number of records to print, or `0` for all (default: `0`)
+     *
+     * @return Number of records printed
+     */
+    static size_t drain(size_t maxRecords=0);
+
+    /**
+     * @brief Retrieve the number of bytes pending in the ring
+     *
+     * @return Number of bytes pending
+     */
+    static size_t pending();
+
+    /**
+     * @brief Check whether a level is recorded (compile-time and runtime)
+     *
+     * @param level  Log level
+     *
+     * @return `true` if recorded, `false` otherwise
+     */
+    static bool enabled(uint8_t level) { return level <= _level; }
+
+    /**
+     * @brief Record a log entry (see: `LOG_ERROR()`, `LOG_DEBUG()`)
+     *
+     * @param level  Log level
+     * @param line   Source line
+     * @param args   Arguments, printed in order
+     * @param count  Number of arguments
+     */
+    static void write(uint8_t level, uint16_t line, const ExoLogArg* args, size_t count);
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  private:
+    static uint8_t _level;
+    static Print* _output;
+    static bool _deferred;
+
+    /**
+     * @brief Prints a record prefix (e.g. `ERROR (line:42) `) to the output
+     */
+    static void printPrefix(uint8_t level, uint16_t line);
+
+    /**
+     * @brief Prints a single argument to the output
+     */
+    static void printArg(const ExoLogArg& arg);
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+#define EXO_LOG_WRITE(level, ...) do { \
+  if (ExositeLog::enabled(level)) { \
+    const ExoLogArg _exoLogArgs[] = {__VA_ARGS__}; \
+    ExositeLog::write(level, __LINE__, _exoLogArgs, sizeof(_exoLogArgs) / sizeof(_exoLogArgs[0])); \
+  } \
+} while (0)
+
+// Error logging
+#if EXO_LOG_LEVEL >= EXO_LOG_LEVEL_ERROR
+  #define LOG_ERROR(...) EXO_LOG_WRITE(EXO_LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+  #define LOG_ERROR(...) do {} while (0)
+#endif
+
+// (Optional) Debug logging
+#if EXO_LOG_LEVEL >= EXO_LOG_LEVEL_DEBUG
+  #define LOG_DEBUG(...) EXO_LOG_WRITE(EXO_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+  #define LOG_DEBUG(...) do {} while (0)
+#endif
@@ -0,0 +1,119 @@
+//************************************************************************************************
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Exosite
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//************************************************************************************************
+
+#include "ExositeRateController.h"
+
+ExositeRateController::ExositeRateController(unsigned long minIntervalMs, unsigned long maxIntervalMs,
+                                             unsigned int maxBatch) {
+  // At least 1 ms, so that `rate()` is defined and backoffs can double the interval
+  _minInterval = minIntervalMs > 0 ? minIntervalMs : 1;
+  _maxInterval = maxIntervalMs > _minInterval ? maxIntervalMs : _minInterval;
+  _maxBatch = maxBatch > 0 ? maxBatch : 1;
+  _step = _minInterval / 4 > 0 ? _minInterval / 4 : 1;
+  _interval = _minInterval;
+}
+
+void ExositeRateController::setTargetLatency(unsigned long targetMs) {
+  _target = targetMs;
+}
+
+void ExositeRateController::setStep(unsigned long stepMs) {
+  _step = stepMs > 0 ? stepMs : 1;
+}
+
+void ExositeRateController::update(const ApiResponse& res, unsigned long roundTripMs) {
+  unsigned long now = millis();
+  _lastUpdate = now;
+  _updated = true;
+
+  if (roundTripMs > 0) {
+    _smoothedRtt = _smoothedRtt ? (_smoothedRtt * 7 + roundTripMs) / 8 : roundTripMs;
+  }
+
+  // Slowness is judged on the smoothed round-trip time, confirmed by the latest one (as the average
+  // lags the link by several requests, i.e. minutes at long intervals, once it recovers)
+  bool congested = !res.success && (res.statusCode == 0 || res.statusCode == 429 || res.statusCode >= 500);
+  bool slow = _smoothedRtt > _target * 2 && roundTripMs > _target * 2;
+  if (congested || slow) {
+    decrease(now);
+  }
+  else if (res.success && roundTripMs > 0 && roundTripMs <= _target) {
+    increase();
+  }
+}
+
+bool ExositeRateController::due() {
+  return !_updated || millis() - _lastUpdate >= _interval;
+}
+
+unsigned long ExositeRateController::interval() {
+  return _interval;
+}
+
+unsigned int ExositeRateController::batchSize() {
+  return _batch;
+}
+
+float ExositeRateController::rate() {
+  return 60000.0f / _interval;
+}
+
+unsigned long ExositeRateController::latency() {
+  return _smoothedRtt;
+}
+
+unsigned long ExositeRateController::backoffs() {
+  return _backoffs;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void ExositeRateController::increase() {
+  _interval = _interval - _minInterval > _step ? _interval - _step : _minInterval;
+
+  if (_batch > 1) {
+    _batch--;
+  }
+}
+
+void ExositeRateController::decrease(unsigned long now) {
+  // Once per interval, so that the results of requests already in flight do not compound
+  if (_backedOff && now - _lastBackoff < _interval) {
+    return;
+  }
+
+  _interval = _interval <= _maxInterval / 2 ? _interval * 2 : _maxInterval;
+  _batch = _batch <= _maxBatch / 2 ? _batch * 2 : _maxBatch;
+
+  _lastBackoff = now;
+  _backedOff = true;
+  _backoffs++;
+}
@@ -0,0 +1,169 @@
+//************************************************************************************************
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Exosite
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
+#include "ExositeHTTP.h"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Additive-increase/multiplicative-decrease (AIMD) controller of the report rate
+ *
+ * Note:
+ *
+ * - Each request result is fed to `update()`, with its round-trip time (see:
+ *   `ExositeHTTP::lastRoundTrip()`)
+ *
+ * - While requests succeed within the target latency, the send interval shrinks by a fixed step
+ *   and the batch size by one (i.e. the rate increases additively)
+ *
+ * - On congestion (failure, HTTP 429/5xx, or a smoothed latency above twice the target, while the
+ *   latest round trip is too), the interval and batch size double (i.e. the rate decreases
+ *   multiplicatively), at most once per interval, so a burst of errors does not back off further
+ *   than needed
+ *
+ * - Other results (e.g. HTTP 4xx, or writes suppressed by report-by-exception) leave the rate unchanged
+ *
+ * - Example:
+ *
+ *     ExositeRateController rate(1000, 60000, 10);
+ *     ...
+ *     if (rate.due()) {
+ *       res = exosite.writeChannels("data_in"); // With up to `rate.batchSize()` samples
+ *       rate.update(res, exosite.lastRoundTrip());
+ *     }
+ */
+class ExositeRateController {
+  public:
+    /**
+     * @brief Create a rate controller, starting at the minimum interval and batch size
+     *
+     * @param minIntervalMs  (Optional) Shortest send interval in milliseconds, at least `1` (default: `1000`)
+     * @param maxIntervalMs  (Optional) Longest send interval in milliseconds (default: `300000`)
+     * @param maxBatch       (Optional) Largest number of samples per request (default: `1`)
+     */
+    ExositeRateController(unsigned long minIntervalMs=1000, unsigned long maxIntervalMs=300000,
+                          unsigned int maxBatch=1);
+
+    /**
+     * @brief Set the round-trip time under which the rate may increase
+     *
+     * @param targetMs  Target round-trip time in milliseconds (default: `1000`)
+     */
+    void setTargetLatency(unsigned long targetMs);
+
+    /**
+     * @brief Set the additive step by which the interval shrinks after each timely success
+     *
+     * @param stepMs  Step in milliseconds (default: `minIntervalMs / 4`, at least `1`)
+     */
+    void setStep(unsigned long stepMs);
+
+    /**
+     * @brief Feed the result of a request to the controller
+     *
+     * @param res          Result of the request
+     * @param roundTripMs  Round-trip time of the request in milliseconds (`0` if unknown)
+     */
+    void update(const ApiResponse& res, unsigned long roundTripMs);
+
+    /**
+     * @brief Check whether the current interval has elapsed since the last `update()`
+     *
+     * @return `true` if the next request is due, `false` otherwise
+     */
+    bool due();
+
+    /**
+     * @brief Retrieve the current send interval
+     *
+     * @return Interval in milliseconds
+     */
+    unsigned long interval();
+
+    /**
+     * @brief Retrieve the current batch size (e.g. samples to aggregate per request)
+     *
+     * @return Batch size (between `1` and `maxBatch`)
+     */
+    unsigned int batchSize();
+
+    /**
+     * @brief Retrieve the current request rate
+     *
+     * @return Requests per minute
+     */
+    float rate();
+
+    /**
+     * @brief Retrieve the smoothed round-trip time
+     *
+     * @return Round-trip time in milliseconds (`0` if none measured)
+     */
+    unsigned long latency();
+
+    /**
+     * @brief Retrieve the number of times the rate was decreased (since construction)
+     *
+     * @return Number of back-offs
+     */
+    unsigned long backoffs();
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  private:
+    unsigned long _minInterval;
+    unsigned long _maxInterval;
+    unsigned int _maxBatch;
+    unsigned long _target = 1000;
+    unsigned long _step;
+
+    unsigned long _interval;
+    unsigned int _batch = 1;
+    unsigned long _smoothedRtt = 0;  // Exponentially weighted (1/8), as for TCP
+    unsigned long _lastUpdate = 0;
+    unsigned long _lastBackoff = 0;
+    bool _updated = false;
+    bool _backedOff = false;
+    unsigned long _backoffs = 0;
+
+    /**
+     * @brief Increases the rate additively
+     */
+    void increase();
+
+    /**
+     * @brief Decreases the rate multiplicatively (at most once per interval)
+     */
+    void decrease(unsigned long now);
+};
@@ -0,0 +1,455 @@
+//************************************************************************************************
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Exosite
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
+#include <Client.h>
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Event types of a wire transcript (see: `ExositeRecorder`)
+ *
+ * Note: Each record is `event (1 B) | delay since the previous record in ms (varint) |
+ * length (varint) | data`, where varints are unsigned LEB128 (7 bits per byte, low first)
+ */
+enum TranscriptEvent : uint8_t {
+  TRANSCRIPT_TX      = 0,  // data sent (by the library)
+  TRANSCRIPT_RX      = 1,  // data received (by the library)
+  TRANSCRIPT_CONNECT = 2,  // connection attempt; data: result (1 B)
+  TRANSCRIPT_STOP    = 3,  // connection closed by the library
+  TRANSCRIPT_CLOSE   = 4   // connection closed by the server
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Client decorator recording a wire transcript of both directions, with their timing
+ *
+ * Note:
+ *
+ * - Consecutive bytes in the same direction and millisecond are combined into one record, so
+ *   slow or partial deliveries remain visible in the transcript
+ *
+ * - `setTimeout()` is not forwarded (it is not virtual), so set it on the wrapped client
+ *
+ * - Example: `ExositeRecorder recorder(&sslClient, &logFile); ExositeHTTP exosite(&recorder, ...);`
+ */
+class ExositeRecorder : public Client {
+  public:
+    /**
+     * @brief Wrap a client, recording its traffic
+     *
+     * @param client  Client to wrap
+     * @param output  Output receiving the transcript (e.g. a file)
+     */
+    ExositeRecorder(Client* client, Print* output) : _client(client), _output(output) {}
+
+    int connect(IPAddress ip, uint16_t port) override {
+      return recordConnect(_client->connect(ip, port));
+    }
+
+    int connect(const char* host, uint16_t port) override {
+      return recordConnect(_client->connect(host, port));
+    }
+
+#if defined(ESP32)
+    // Also pure virtual in the ESP32 core (timeout in milliseconds)
+    int connect(IPAddress ip, uint16_t port, int32_t timeout) override {
+      return recordConnect(_client->connect(ip, port, timeout));
+    }
+
+    int connect(const char* host, uint16_t port, int32_t timeout) override {
+      return recordConnect(_client->connect(host, port, timeout));
+    }
+#endif
+
+    size_t write(uint8_t c) override {
+      return write(&c, 1);
+    }
+
+    size_t write(const uint8_t* buf, size_t size) override {
+      size_t written = _client->write(buf, size);
+      stage(TRANSCRIPT_TX, buf, written);
+      return written;
+    }
+
+    int available() override {
+      return _client->available();
+    }
+
+    int read() override {
+      int c = _client->read();
+      if (c >= 0) {
+        uint8_t byte = c;
+        stage(TRANSCRIPT_RX, &byte, 1);
+      }
+      return c;
+    }
+
+    int read(uint8_t* buf, size_t size) override {
+      int count = _client->read(buf, size);
+      if (count > 0) {
+        stage(TRANSCRIPT_RX, buf, count);
+      }
+      return count;
+    }
+
+    int peek() override {
+      return _client->peek();
+    }
+
+    void flush() override {
+      _client->flush();
+      flushRecord();
+    }
+
+    void stop() override {
+      _client->stop();
+      record(TRANSCRIPT_STOP, nullptr, 0);
+      _open = false;
+    }
+
+    uint8_t connected() override {
+      uint8_t state = _client->connected();
+      if (_open && !state) {
+        record(TRANSCRIPT_CLOSE, nullptr, 0);
+        _open = false;
+      }
+      return state;
+    }
+
+    operator bool() override {
+      return (bool)*_client;
+    }
+
+    /**
+     * @brief Write any staged data to the transcript (e.g. before closing the output)
+     */
+    void flushRecord() {
+      if (_stageLen > 0) {
+        writeRecord(_stageEvent, _stageTime, _stage, _stageLen);
+        _stageLen = 0;
+      }
+    }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  private:
+    Client* _client;
+    Print* _output;
+    bool _open = false;
+
+    unsigned long _lastRecord = 0; // Time (ms) of the last record written
+    bool _recorded = false;
+
+    uint8_t _stage[64];            // Data combined into the next record
+    size_t _stageLen = 0;
+    uint8_t _stageEvent = TRANSCRIPT_TX;
+    unsigned long _stageTime = 0;
+
+    int recordConnect(int result) {
+      uint8_t byte = result;
+      record(TRANSCRIPT_CONNECT, &byte, 1);
+      _open = result > 0;
+      return result;
+    }
+
+    /**
+     * @brief Records an event immediately (after any staged data)
+     */
+    void record(uint8_t event, const uint8_t* data, size_t len) {
+      flushRecord();
+      writeRecord(event, millis(), data, len);
+    }
+
+    /**
+     * @brief Adds data to the staged record, starting a new one on a change of direction or time
+     */
+    void stage(uint8_t event, const uint8_t* data, size_t len) {
+      unsigned long now = millis();
+
+      while (len > 0) {
+        if (_stageLen > 0 && (_stageEvent != event || _stageTime != now || _stageLen == sizeof(_stage))) {
+          flushRecord();
+        }
+        if (_stageLen == 0) {
+          _stageEvent = event;
+          _stageTime = now;
+        }
+
+        size_t chunk = sizeof(_stage) - _stageLen;
+        chunk = chunk < len ? chunk : len;
+        memcpy(_stage + _stageLen, data, chunk);
+        _stageLen += chunk;
+        data += chunk;
+        len -= chunk;
+      }
+    }
+
+    void writeRecord(uint8_t event, unsigned long time, const uint8_t* data, size_t len) {
+      unsigned long delay = _recorded ? time - _lastRecord : 0;
+      _lastRecord = time;
+      _recorded = true;
+
+      _output->write(event);
+      writeVarint(delay);
+      writeVarint(len);
+      if (len > 0) {
+        _output->write(data, len);
+      }
+    }
+
+    void writeVarint(unsigned long value) {
+      do {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        _output->write(value ? (uint8_t)(byte | 0x80) : byte);
+      } while (value);
+    }
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Client replaying a wire transcript recorded by `ExositeRecorder`
+ *
+ * Note:
+ *
+ * - Received data is delivered as recorded (in the same chunks), either as fast as it is read
+ *   (default) or with the recorded delays (see: `setSpeed()`)
+ *
+ * - Sent data is compared against the transcript, and differences counted (see: `mismatches()`)
+ */
+class ExositeReplayClient : public Client {
+  public:
+    /**
+     * @brief Replay a transcript
+     *
+     * @param data    Transcript (must remain valid while replaying)
+     * @param length  Length of the transcript
+     */
+    ExositeReplayClient(const uint8_t* data, size_t length) : _data(data), _length(length) {
+      nextRecord();
+    }
+
+    /**
+     * @brief Set the replay speed
+     *
+     * @param speed  `0` to ignore recorded delays (default), `1` for real time, `2` for twice as fast, ...
+     */
+    void setSpeed(float speed) {
+      _speed = speed;
+    }
+
+    /**
+     * @brief Check whether the whole transcript was replayed
+     */
+    bool finished() {
+      return _event < 0;
+    }
+
+    /**
+     * @brief Retrieve the number of sent bytes differing from (or missing in) the transcript
+     */
+    unsigned long mismatches() {
+      return _mismatches;
+    }
+
+    int connect(IPAddress, uint16_t) override {
+      return replayConnect();
+    }
+
+    int connect(const char*, uint16_t) override {
+      return replayConnect();
+    }
+
+#if defined(ESP32)
+    int connect(IPAddress, uint16_t, int32_t) override {
+      return replayConnect();
+    }
+
+    int connect(const char*, uint16_t, int32_t) override {
+      return replayConnect();
+    }
+#endif
+
+    size_t write(uint8_t c) override {
+      return write(&c, 1);
+    }
+
+    size_t write(const uint8_t* buf, size_t size) override {
+      for (size_t i = 0; i < size; i++) {
+        if (_event == TRANSCRIPT_TX) {
+          if (_record[_offset] != buf[i]) {
+            _mismatches++;
+          }
+          if (++_offset == _recordLen) {
+            nextRecord();
+          }
+        }
+        else {
+          _mismatches++;
+        }
+      }
+      return size;
+    }
+
+    int available() override {
+      // Reaching a server close ends the connection (once its delay has elapsed)
+      if (_event == TRANSCRIPT_CLOSE && due()) {
+        _open = false;
+        nextRecord();
+      }
+      return (_event == TRANSCRIPT_RX && due()) ? _recordLen - _offset : 0;
+    }
+
+    int read() override {
+      if (available() <= 0) {
+        return -1;
+      }
+      uint8_t c = _record[_offset];
+      if (++_offset == _recordLen) {
+        nextRecord();
+      }
+      return c;
+    }
+
+    int read(uint8_t* buf, size_t size) override {
+      size_t count = 0;
+      while (count < size && available() > 0) {
+        buf[count++] = read();
+      }
+      return count;
+    }
+
+    int peek() override {
+      return available() > 0 ? _record[_offset] : -1;
+    }
+
+    void flush() override {}
+
+    void stop() override {
+      // Skip whatever was left unread or unsent, up to the recorded stop
+      while (_event >= 0 && _event != TRANSCRIPT_CONNECT) {
+        bool stopped = _event == TRANSCRIPT_STOP;
+        nextRecord();
+        if (stopped) {
+          break;
+        }
+      }
+      _open = false;
+    }
+
+    uint8_t connected() override {
+      // Data still pending keeps the connection readable after a server close
+      return available() > 0 || _open;
+    }
+
+    operator bool() override {
+      return _open;
+    }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  private:
+    const uint8_t* _data;
+    size_t _length;
+    size_t _pos = 0;
+    float _speed = 0;
+    bool _open = false;
+    unsigned long _mismatches = 0;
+
+    // Current record (`_event` is `-1` at the end of the transcript)
+    int _event = -1;
+    unsigned long _delay = 0;
+    const uint8_t* _record = nullptr;
+    size_t _recordLen = 0;
+    size_t _offset = 0;
+    unsigned long _since = 0;  // Time (ms) the previous record completed
+
+    int replayConnect() {
+      // Skip to the next recorded connection attempt
+      while (_event >= 0 && _event != TRANSCRIPT_CONNECT) {
+        nextRecord();
+      }
+      if (_event < 0) {
+        return 0;
+      }
+
+      int result = _recordLen > 0 ? (int8_t)_record[0] : 0;
+      nextRecord();
+      _open = result > 0;
+      return result;
+    }
+
+    bool due() {
+      return _speed <= 0 || millis() - _since >= (unsigned long)(_delay / _speed);
+    }
+
+    void nextRecord() {
+      _since = millis();
+      _event = -1;
+      _offset = 0;
+
+      unsigned long len;
+      if (_pos >= _length) {
+        return;
+      }
+      uint8_t event = _data[_pos++];
+      if (!readVarint(_delay) || !readVarint(len) || len > _length - _pos) {
+        return;
+      }
+
+      _event = event;
+      _record = _data + _pos;
+      _recordLen = len;
+      _pos += len;
+
+      // Records without data complete immediately (except events awaited by the library)
+      if (_recordLen == 0 && (_event == TRANSCRIPT_TX || _event == TRANSCRIPT_RX)) {
+        nextRecord();
+      }
+    }
+
+    bool readVarint(unsigned long& value) {
+      value = 0;
+      for (unsigned int shift = 0; _pos < _length && shift < 32; shift += 7) {
+        uint8_t byte = _data[_pos++];
+        value |= (unsigned long)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+          return true;
+        }
+      }
+      return false;
+    }
+};
@@ -0,0 +1,181 @@
+//************************************************************************************************
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Exosite
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//************************************************************************************************
+
+#include "ExositeSampleBuffer.h"
+
+ExositeSampleBuffer::ExositeSampleBuffer(unsigned long windowMs) : _windowMs(windowMs) {
+  reset();
+}
+
+int ExositeSampleBuffer::addChannel(const char* channel, uint8_t aggregates, unsigned int precision) {
+  if (!channel || _channelCount >= EXO_SAMPLE_MAX_CHANNELS) {
+    LOG_ERROR(G("Cannot add sample channel: "), channel ? channel : "");
+    return -1;
+  }
+
+  unsigned int index = _channelCount++;
+  _keys[index] = channel;
+  _aggregates[index] = aggregates ? aggregates : (uint8_t)AGGREGATE_MEAN;
+  _precision[index] = precision;
+  _count[index] = 0;
+  _sum[index] = 0;
+
+  return index;
+}
+
+bool ExositeSampleBuffer::addSample(int channel, float value) {
+  if (channel < 0 || (unsigned int)channel >= _channelCount || isnan(value) || isinf(value)) {
+    return false;
+  }
+
+  if (_count[channel] == 0) {
+    _min[channel] = value;
+    _max[channel] = value;
+  } else if (value < _min[channel]) {
+    _min[channel] = value;
+  } else if (value > _max[channel]) {
+    _max[channel] = value;
+  }
+
+  _last[channel] = value;
+  _sum[channel] += value;
+  _count[channel]++;
+  return true;
+}
+
+bool ExositeSampleBuffer::getSummary(int channel, SampleSummary& summary) {
+  memset(&summary, 0, sizeof(summary));
+  if (channel < 0 || (unsigned int)channel >= _channelCount || _count[channel] == 0) {
+    return false;
+  }
+
+  summary.min = _min[channel];
+  summary.max = _max[channel];
+  summary.mean = _sum[channel] / _count[channel];
+  summary.last = _last[channel];
+  summary.count = _count[channel];
+  return true;
+}
+
+bool ExositeSampleBuffer::due() {
+  if (millis() - _windowStart < _windowMs) {
+    return false;
+  }
+
+  for (unsigned int i = 0; i < _channelCount; i++) {
+    if (_count[i] > 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+ApiResponse ExositeSampleBuffer::report(ExositeHTTP& exosite, const char* resource) {
+  ApiResponse res;
+  res.statusCode = 0;
+  res.success = true;
+
+  bool pending = false;
+  exosite.beginChannels();
+
+  for (unsigned int i = 0; i < _channelCount; i++) {
+    if (_count[i] == 0) {
+      continue;
+    }
+
+    uint8_t aggregates = _aggregates[i];
+    bool suffix = (aggregates & (aggregates - 1)) != 0; // More than one aggregate
+
+    for (uint8_t aggregate = AGGREGATE_MIN; aggregate <= AGGREGATE_COUNT; aggregate <<= 1) {
+      if ((aggregates & aggregate) && !addAggregate(exosite, i, aggregate, suffix)) {
+        res.success = false;
+        return res;
+      }
+    }
+    pending = true;
+  }
+
+  if (!pending) {
+    _windowStart = millis();
+    return res;
+  }
+
+  res = exosite.writeChannels(resource);
+  if (res.success) {
+    reset();
+  }
+
+  return res;
+}
+
+void ExositeSampleBuffer::reset() {
+  for (unsigned int i = 0; i < _channelCount; i++) {
+    _count[i] = 0;
+    _sum[i] = 0;
+  }
+  _windowStart = millis();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+bool ExositeSampleBuffer::addAggregate(ExositeHTTP& exosite, unsigned int channel, uint8_t aggregate, bool suffix) {
+  const char* key = _keys[channel];
+  char suffixed[40];
+
+  if (suffix) {
+    const char* name = aggregate == AGGREGATE_MIN ? "_min" :
+                       aggregate == AGGREGATE_MAX ? "_max" :
+                       aggregate == AGGREGATE_MEAN ? "_mean" :
+                       aggregate == AGGREGATE_LAST ? "_last" : "_count";
+
+    if (strlen(key) + strlen(name) >= sizeof(suffixed)) {
+      LOG_ERROR(G("Sample channel key too long: "), key);
+      return false;
+    }
+    strcpy(suffixed, key);
+    strcat(suffixed, name);
+    key = suffixed;
+  }
+
+  switch (aggregate) {
+    case AGGREGATE_MIN:
+      return exosite.addChannel(key, (double)_min[channel], _precision[channel]);
+    case AGGREGATE_MAX:
+      return exosite.addChannel(key, (double)_max[channel], _precision[channel]);
+    case AGGREGATE_MEAN:
+      return exosite.addChannel(key, _sum[channel] / _count[channel], _precision[channel]);
+    case AGGREGATE_LAST:
+      return exosite.addChannel(key, (double)_last[channel], _precision[channel]);
+    default:
+      return exosite.addChannel(key, (long)_count[channel]);
+  }
+}
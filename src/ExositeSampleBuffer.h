@@ -0,0 +1,199 @@
+//************************************************************************************************
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Exosite
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
+#include "ExositeHTTP.h"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Optional Overrides
+
+// Max number of channels per sample buffer (uncomment to override)
+// #define EXO_SAMPLE_MAX_CHANNELS 8
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+#ifndef EXO_SAMPLE_MAX_CHANNELS
+  #define EXO_SAMPLE_MAX_CHANNELS 8
+#endif
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Aggregates reported for a channel (combine with `|`)
+ *
+ * Note: With a single aggregate, it is reported under the channel key itself (e.g. `001`);
+ * with several, each is reported under the key and a suffix (e.g. `001_min`, `001_max`)
+ */
+enum SampleAggregate {
+  AGGREGATE_MIN   = 0x01,
+  AGGREGATE_MAX   = 0x02,
+  AGGREGATE_MEAN  = 0x04,
+  AGGREGATE_LAST  = 0x08,
+  AGGREGATE_COUNT = 0x10
+};
+
+/**
+ * @brief Aggregates of a channel over the current window
+ */
+struct SampleSummary {
+  float min;
+  float max;
+  float mean;
+  float last;
+  unsigned long count;
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Fixed-capacity, per-channel sample buffer reporting windowed aggregates
+ *
+ * Note:
+ *
+ * - Samples are not stored: each one updates the running min, max, sum, last value, and count
+ *   of its channel in O(1), so channels may be sampled at any rate with constant memory
+ *   (~30 B per channel on 32-bit targets)
+ *
+ * - Once per window (see: `due()`), `report()` writes a single channel payload holding the
+ *   aggregates of every sampled channel, then starts a new window
+ *
+ * - Example:
+ *
+ *     ExositeSampleBuffer samples(10000);
+ *     int temp = samples.addChannel("001", AGGREGATE_MEAN | AGGREGATE_MAX);
+ *     ...
+ *     samples.addSample(temp, readTemperature());
+ *     if (samples.due()) samples.report(exosite, "data_in");
+ */
+class ExositeSampleBuffer {
+  public:
+    /**
+     * @brief Create a sample buffer
+     *
+     * @param windowMs  (Optional) Duration of each aggregation window in milliseconds (default: `10000`)
+     */
+    ExositeSampleBuffer(unsigned long windowMs=10000);
+
+    /**
+     * @brief Add a channel to the buffer
+     *
+     * Note: `channel` must remain valid for the lifetime of the buffer
+     *
+     * @param channel     Channel key (e.g. `001`)
+     * @param aggregates  (Optional) Aggregates to report (see: `SampleAggregate`); (default: `AGGREGATE_MEAN`)
+     * @param precision   (Optional) Decimal places of the reported values (default: `2`)
+     *
+     * @return Index of the channel (for `addSample()`), or `-1` if the buffer is full
+     */
+    int addChannel(const char* channel, uint8_t aggregates=AGGREGATE_MEAN, unsigned int precision=2);
+
+    /**
+     * @brief Add a sample to a channel
+     *
+     * @param channel  Index of the channel (see: `addChannel()`)
+     * @param value    Sample value
+     *
+     * @return `true` if added, `false` if the channel is invalid or the value is not finite
+     */
+    bool addSample(int channel, float value);
+
+    /**
+     * @brief Retrieve the aggregates of a channel over the current window
+     *
+     * @param channel  Index of the channel (see: `addChannel()`)
+     * @param summary  Aggregates of the channel (all `0` if not sampled)
+     *
+     * @return `true` if the channel has samples in the current window, `false` otherwise
+     */
+    bool getSummary(int channel, SampleSummary& summary);
+
+    /**
+     * @brief Check whether the current window has elapsed
+     *
+     * @return `true` if the window has elapsed and samples are pending, `false` otherwise
+     */
+    bool due();
+
+    /**
+     * @brief Write the aggregates of the current window, and start a new window if successful
+     *
+     * Note:
+     *
+     * - Channels without samples in the window are left out of the payload
+     *
+     * - If the write fails, the window is kept (and extended) so that its samples are included in
+     *   the next report
+     *
+     * @param exosite   Client through which to write (see: `ExositeHTTP::writeChannels()`)
+     * @param resource  Target resource (e.g. `data_in`)
+     *
+     * @return Response of the write (`success` with `statusCode` `0` if there was nothing to report)
+     */
+    ApiResponse report(ExositeHTTP& exosite, const char* resource);
+
+    /**
+     * @brief Discard all pending samples and start a new window
+     */
+    void reset();
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  private:
+    unsigned long _windowMs;
+    unsigned long _windowStart;
+
+    // Channel configuration
+    const char* _keys[EXO_SAMPLE_MAX_CHANNELS];
+    uint8_t _aggregates[EXO_SAMPLE_MAX_CHANNELS];
+    uint8_t _precision[EXO_SAMPLE_MAX_CHANNELS];
+    unsigned int _channelCount = 0;
+
+    // Running aggregates (one array per column, so a report walks each column contiguously)
+    float _min[EXO_SAMPLE_MAX_CHANNELS];
+    float _max[EXO_SAMPLE_MAX_CHANNELS];
+    float _last[EXO_SAMPLE_MAX_CHANNELS];
+    double _sum[EXO_SAMPLE_MAX_CHANNELS];
+    unsigned long _count[EXO_SAMPLE_MAX_CHANNELS];
+
+    /**
+     * @brief Adds a single aggregate of a channel to the payload being built
+     *
+     * @param exosite    Client building the payload
+     * @param channel    Index of the channel
+     * @param aggregate  Aggregate to add (a single `SampleAggregate`)
+     * @param suffix     Whether to suffix the channel key (e.g. `_min`)
+     *
+     * @return `true` if added, `false` if the payload is full
+     */
+    bool addAggregate(ExositeHTTP& exosite, unsigned int channel, uint8_t aggregate, bool suffix);
+};
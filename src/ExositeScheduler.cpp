@@ -0,0 +1,181 @@
+//************************************************************************************************
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Exosite
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//************************************************************************************************
+
+#include "ExositeScheduler.h"
+
+ExositeScheduler::ExositeScheduler(ExositeHTTP& exosite) : _exosite(exosite) {
+  memset(_stats, 0, sizeof(_stats));
+  clear();
+}
+
+bool ExositeScheduler::submit(const char* resource, const char* value, RequestPriority priority, unsigned long deadlineMs) {
+  if (!resource || !value || priority >= PRIORITY_COUNT ||
+      strlen(resource) >= EXO_RESOURCE_NAME_SIZE || strlen(value) >= EXO_SCHEDULER_VALUE_SIZE) {
+    LOG_ERROR(G("Cannot schedule write: "), resource ? resource : "");
+    return false;
+  }
+
+  unsigned long now = millis();
+  SchedulerStats& stats = _stats[priority];
+
+  // Collapse telemetry: the newest value replaces a queued one (keeping its place in the queue)
+  if (priority != PRIORITY_URGENT) {
+    for (size_t i = 0; i < EXO_SCHEDULER_DEPTH; i++) {
+      Entry& entry = _entries[i];
+      if (entry.used && entry.priority == priority && strcmp(entry.resource, resource) == 0) {
+        // The queueing delay still counts from the first value, while the deadline follows the
+        // newest value (stored relative to `enqueuedAt`)
+        strcpy(entry.value, value);
+        entry.deadline = deadlineMs > 0 ? (now - entry.enqueuedAt) + deadlineMs : 0;
+        stats.submitted++;
+        stats.collapsed++;
+        return true;
+      }
+    }
+  }
+
+  expire(now);
+
+  Entry* entry = allocate(priority);
+  if (!entry) {
+    LOG_DEBUG(G("Write queue full, dropping: "), resource);
+    stats.dropped++;
+    return false;
+  }
+
+  entry->used = true;
+  entry->priority = priority;
+  entry->sequence = _sequence++;
+  entry->enqueuedAt = now;
+  entry->deadline = deadlineMs;
+  strcpy(entry->resource, resource);
+  strcpy(entry->value, value);
+
+  stats.submitted++;
+  return true;
+}
+
+bool ExositeScheduler::process(ApiResponse* result) {
+  expire(millis());
+
+  // Oldest write of the highest priority class
+  Entry* next = nullptr;
+  for (size_t i = 0; i < EXO_SCHEDULER_DEPTH; i++) {
+    Entry& entry = _entries[i];
+    if (entry.used && (!next || entry.priority < next->priority ||
+                       (entry.priority == next->priority && entry.sequence < next->sequence))) {
+      next = &entry;
+    }
+  }
+
+  if (!next) {
+    return false;
+  }
+
+  SchedulerStats& stats = _stats[next->priority];
+  unsigned long delay = millis() - next->enqueuedAt;
+  stats.totalDelayMs += delay;
+  if (delay > stats.maxDelayMs) {
+    stats.maxDelayMs = delay;
+  }
+
+  // Release the slot before sending, so it stays consistent if the write is interrupted
+  next->used = false;
+  ApiResponse res = _exosite.write(next->resource, next->value);
+
+  stats.sent++;
+  if (!res.success) {
+    stats.failed++;
+  }
+
+  if (result) {
+    *result = res;
+  }
+  return true;
+}
+
+size_t ExositeScheduler::pending(RequestPriority priority) {
+  size_t count = 0;
+  for (size_t i = 0; i < EXO_SCHEDULER_DEPTH; i++) {
+    if (_entries[i].used && (priority == PRIORITY_COUNT || _entries[i].priority == priority)) {
+      count++;
+    }
+  }
+  return count;
+}
+
+SchedulerStats ExositeScheduler::getStats(RequestPriority priority) {
+  return _stats[priority < PRIORITY_COUNT ? priority : 0];
+}
+
+void ExositeScheduler::clear() {
+  for (size_t i = 0; i < EXO_SCHEDULER_DEPTH; i++) {
+    _entries[i].used = false;
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void ExositeScheduler::expire(unsigned long now) {
+  for (size_t i = 0; i < EXO_SCHEDULER_DEPTH; i++) {
+    Entry& entry = _entries[i];
+    if (entry.used && entry.deadline > 0 && now - entry.enqueuedAt >= entry.deadline) {
+      LOG_DEBUG(G("Write expired, dropping: "), entry.resource);
+      entry.used = false;
+      _stats[entry.priority].expired++;
+    }
+  }
+}
+
+ExositeScheduler::Entry* ExositeScheduler::allocate(uint8_t priority) {
+  Entry* victim = nullptr;
+
+  for (size_t i = 0; i < EXO_SCHEDULER_DEPTH; i++) {
+    Entry& entry = _entries[i];
+    if (!entry.used) {
+      return &entry;
+    }
+
+    // Oldest write of the lowest class (below the new write's class)
+    if (entry.priority > priority && (!victim || entry.priority > victim->priority ||
+                                      (entry.priority == victim->priority && entry.sequence < victim->sequence))) {
+      victim = &entry;
+    }
+  }
+
+  if (victim) {
+    LOG_DEBUG(G("Write queue full, evicting: "), victim->resource);
+    _stats[victim->priority].dropped++;
+    victim->used = false;
+  }
+
+  return victim;
+}
@@ -0,0 +1,183 @@
+//************************************************************************************************
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Exosite
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//************************************************************************************************
+
+#pragma once
+
+#include <Arduino.h>
+#include "ExositeHTTP.h"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Optional Overrides
+
+// Number of queued writes, and max length of a queued value (uncomment to override)
+// #define EXO_SCHEDULER_DEPTH 8
+// #define EXO_SCHEDULER_VALUE_SIZE 256
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+#ifndef EXO_SCHEDULER_DEPTH
+  #define EXO_SCHEDULER_DEPTH 8
+#endif
+
+#ifndef EXO_SCHEDULER_VALUE_SIZE
+  #define EXO_SCHEDULER_VALUE_SIZE 256
+#endif
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Priority classes of scheduled writes (highest first)
+ */
+enum RequestPriority {
+  PRIORITY_URGENT,      // e.g. control acknowledgements; never collapsed
+  PRIORITY_NORMAL,      // e.g. telemetry; collapsed per resource (last value wins)
+  PRIORITY_BACKGROUND,  // e.g. diagnostics; collapsed per resource (last value wins)
+  PRIORITY_COUNT
+};
+
+/**
+ * @brief Struct representing the counters of one priority class (see: `getStats()`)
+ */
+struct SchedulerStats {
+  unsigned long submitted;     // writes accepted by `submit()`
+  unsigned long sent;          // writes sent (successfully or not)
+  unsigned long failed;        // writes sent without success
+  unsigned long collapsed;     // writes replaced by a newer value for the same resource
+  unsigned long expired;       // writes dropped at their deadline
+  unsigned long dropped;       // writes rejected or evicted because the queue was full
+  unsigned long totalDelayMs;  // total queueing delay (ms) of sent writes
+  unsigned long maxDelayMs;    // longest queueing delay (ms) of a sent write
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Fixed-capacity priority queue of writes for an `ExositeHTTP` instance
+ *
+ * Note:
+ *
+ * - `process()` always sends the oldest write of the highest priority class first, so urgent
+ *   writes are never delayed by queued telemetry
+ *
+ * - Below `PRIORITY_URGENT`, a write to a resource already queued (in the same class) replaces
+ *   the queued value, keeping its place in the queue and its queueing delay (measured from the
+ *   first value), while its deadline is measured from the newest value
+ *
+ * - Writes with a deadline are dropped once it has passed, rather than sent late
+ *
+ * - When the queue is full, a write evicts the oldest write of a lower class (if any)
+ *
+ * - Failed writes are not retried (see: `process()`)
+ */
+class ExositeScheduler {
+  public:
+    /**
+     * @brief Create a scheduler sending through the provided instance
+     *
+     * @param exosite  Instance through which to send writes
+     */
+    ExositeScheduler(ExositeHTTP& exosite);
+
+    /**
+     * @brief Queue a write
+     *
+     * @param resource    Target resource (e.g. `data_in`)
+     * @param value       Value to be written (copied)
+     * @param priority    (Optional) Priority class (default: `PRIORITY_NORMAL`)
+     * @param deadlineMs  (Optional) Time (ms from now) after which the write is dropped, or `0` for none (default)
+     *
+     * @return `true` if queued (or collapsed), `false` if the queue is full or the arguments too long
+     */
+    bool submit(const char* resource, const char* value, RequestPriority priority=PRIORITY_NORMAL,
+                unsigned long deadlineMs=0);
+
+    /**
+     * @brief Send the next queued write (dropping any expired writes first)
+     *
+     * @param result  (Optional) Result of the write
+     *
+     * @return `true` if a write was sent, `false` if the queue is empty
+     */
+    bool process(ApiResponse* result=nullptr);
+
+    /**
+     * @brief Retrieve the number of queued writes
+     *
+     * @param priority  (Optional) Priority class, or `PRIORITY_COUNT` for all (default)
+     *
+     * @return Number of queued writes
+     */
+    size_t pending(RequestPriority priority=PRIORITY_COUNT);
+
+    /**
+     * @brief Retrieve the counters of a priority class (e.g. average queueing delay)
+     *
+     * @param priority  Priority class
+     *
+     * @return Counters of the class (since construction)
+     */
+    SchedulerStats getStats(RequestPriority priority);
+
+    /**
+     * @brief Drop all queued writes (without counting them)
+     */
+    void clear();
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  private:
+    struct Entry {
+      bool used;
+      uint8_t priority;
+      unsigned long sequence;    // Submission order (within and across classes)
+      unsigned long enqueuedAt;
+      unsigned long deadline;    // Time-to-live (ms) from `enqueuedAt`, or `0` for none
+      char resource[EXO_RESOURCE_NAME_SIZE];
+      char value[EXO_SCHEDULER_VALUE_SIZE];
+    };
+
+    ExositeHTTP& _exosite;
+    Entry _entries[EXO_SCHEDULER_DEPTH];
+    unsigned long _sequence = 0;
+    SchedulerStats _stats[PRIORITY_COUNT];
+
+    /**
+     * @brief Drops queued writes past their deadline
+     */
+    void expire(unsigned long now);
+
+    /**
+     * @brief Finds a free slot, evicting the oldest write of the lowest class below `priority`
+     *
+     * @return Free slot, or `nullptr` if none could be freed
+     */
+    Entry* allocate(uint8_t priority);
+};
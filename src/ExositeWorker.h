@@ -0,0 +1,311 @@
+//************************************************************************************************
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Exosite
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//************************************************************************************************
+
+#pragma once
+
+// Note: Requires a toolchain providing <atomic> (e.g. Mbed OS, ESP32), so it is kept header-only
+// and is not included by "ExositeHTTP.h"
+
+#include <atomic>
+
+#include "ExositeHTTP.h"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Optional Overrides
+
+// Number of request/result slots, and max length of a value in a slot (uncomment to override)
+// #define EXO_WORKER_QUEUE_DEPTH 8
+// #define EXO_WORKER_VALUE_SIZE 256
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+#ifndef EXO_WORKER_QUEUE_DEPTH
+  #define EXO_WORKER_QUEUE_DEPTH 8
+#endif
+
+#ifndef EXO_WORKER_VALUE_SIZE
+  #define EXO_WORKER_VALUE_SIZE 256
+#endif
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Lock-free single-producer/single-consumer queue of fixed slots
+ *
+ * Note: Slots are filled and read in place (`back()`/`push()`, `front()`/`pop()`), so entries
+ * are never copied through the queue
+ */
+template<typename T, size_t N>
+class ExoSpscQueue {
+  public:
+    /**
+     * @brief (Producer) Retrieve the next free slot, to be filled then published with `push()`
+     *
+     * @return Free slot, or `nullptr` if the queue is full
+     */
+    T* back() {
+      size_t head = _head.load(std::memory_order_relaxed);
+      if (head - _tail.load(std::memory_order_acquire) >= N) {
+        return nullptr;
+      }
+      return &_slots[head % N];
+    }
+
+    /**
+     * @brief (Producer) Publish the slot retrieved with `back()`
+     */
+    void push() {
+      _head.store(_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief (Consumer) Retrieve the oldest published slot, to be released with `pop()`
+     *
+     * @return Oldest slot, or `nullptr` if the queue is empty
+     */
+    T* front() {
+      size_t tail = _tail.load(std::memory_order_relaxed);
+      if (tail == _head.load(std::memory_order_acquire)) {
+        return nullptr;
+      }
+      return &_slots[tail % N];
+    }
+
+    /**
+     * @brief (Consumer) Release the slot retrieved with `front()`
+     */
+    void pop() {
+      _tail.store(_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Retrieve the number of published slots (approximate while in use)
+     */
+    size_t size() const {
+      return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+
+  private:
+    T _slots[N];
+    std::atomic<size_t> _head{0}; // Slots published (written by the producer only)
+    std::atomic<size_t> _tail{0}; // Slots released (written by the consumer only)
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+/**
+ * @brief Completed request of an `ExositeWorker`
+ */
+struct WorkerResult {
+  uint32_t tag;                       // Tag provided when submitted
+  bool isRead;
+  ApiResponse response;
+  char value[EXO_WORKER_VALUE_SIZE];  // Decoded value (reads only)
+};
+
+/**
+ * @brief Runs requests of an `ExositeHTTP` instance on a dedicated network thread
+ *
+ * Note:
+ *
+ * - The network thread owns the `ExositeHTTP` instance (no other thread may use it), and runs
+ *   `run()` (or calls `process()`); one application thread submits requests and collects results
+ *
+ * - Requests and results are passed through lock-free queues of fixed slots, so submitting never
+ *   blocks on the network (and fails, rather than waits, when the queue is full)
+ *
+ * - Library logging is not thread-safe: with deferred logging (see: `ExositeLog::setDeferred()`),
+ *   call `ExositeLog::drain()` from the network thread only (e.g. between `process()` calls), and
+ *   do not use any other `ExositeHTTP` instance from the application thread
+ *
+ * - Example (Mbed OS):
+ *
+ *     ExositeWorker worker(exosite);
+ *     rtos::Thread network;
+ *     network.start(mbed::callback(&worker, &ExositeWorker::run));
+ *     ...
+ *     worker.submitWrite("data_in", payload);
+ *     while (worker.poll(result)) { ... }
+ */
+class ExositeWorker {
+  public:
+    /**
+     * @brief Create a worker for the provided instance
+     *
+     * @param exosite  Instance to be used by the network thread only
+     */
+    ExositeWorker(ExositeHTTP& exosite) : _exosite(exosite) {}
+
+    /**
+     * @brief (Application thread) Submit a write request
+     *
+     * @param resource  Target resource (e.g. `data_in`)
+     * @param value     Value to be written (copied into the slot)
+     * @param tag       (Optional) Tag returned with the result
+     *
+     * @return `true` if queued, `false` if the queue is full or the arguments too long
+     */
+    bool submitWrite(const char* resource, const char* value, uint32_t tag=0) {
+      return submit(resource, value, tag);
+    }
+
+    /**
+     * @brief (Application thread) Submit a read request
+     *
+     * @param resource  Resource to read (e.g. `data_out`)
+     * @param tag       (Optional) Tag returned with the result
+     *
+     * @return `true` if queued, `false` if the queue is full or the resource too long
+     */
+    bool submitRead(const char* resource, uint32_t tag=0) {
+      return submit(resource, nullptr, tag);
+    }
+
+    /**
+     * @brief (Application thread) Retrieve the next completed request
+     *
+     * @param result  Result of the request
+     *
+     * @return `true` if a result was retrieved, `false` if none is pending
+     */
+    bool poll(WorkerResult& result) {
+      WorkerResult* slot = _results.front();
+      if (!slot) {
+        return false;
+      }
+      result = *slot;
+      _results.pop();
+      return true;
+    }
+
+    /**
+     * @brief (Network thread) Run the next pending request, if any
+     *
+     * Note: Requests are held while the result queue is full (until results are polled)
+     *
+     * @return `true` if a request was run, `false` otherwise
+     */
+    bool process() {
+      Request* request = _requests.front();
+      WorkerResult* result = request ? _results.back() : nullptr;
+      if (!result) {
+        return false;
+      }
+
+      result->tag = request->tag;
+      result->isRead = !request->isWrite;
+
+      if (request->isWrite) {
+        result->value[0] = '\0';
+        result->response = _exosite.write(request->resource, request->value);
+      } else {
+        result->response = _exosite.read(request->resource, result->value, sizeof(result->value));
+      }
+
+      _requests.pop();
+      _results.push();
+      return true;
+    }
+
+    /**
+     * @brief (Network thread) Run requests until `stop()` is called
+     *
+     * @param idleMs  (Optional) Delay while no request is pending, in milliseconds (default: `1`)
+     */
+    void run(unsigned long idleMs) {
+      while (!_stop.load(std::memory_order_acquire)) {
+        if (!process()) {
+          delay(idleMs);
+        }
+      }
+    }
+
+    /**
+     * @brief (Network thread) Run requests until `stop()` is called, with a 1 ms idle delay
+     *
+     * Note: Provided as an overload (rather than a default argument) for use as a thread entry
+     * point (e.g. `mbed::callback(&worker, &ExositeWorker::run)`)
+     */
+    void run() {
+      run(1);
+    }
+
+    /**
+     * @brief Request `run()` to return (after the request in progress, if any)
+     */
+    void stop() {
+      _stop.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Retrieve the number of requests waiting to be run
+     */
+    size_t pending() const {
+      return _requests.size();
+    }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+  private:
+    struct Request {
+      uint32_t tag;
+      bool isWrite;
+      char resource[EXO_RESOURCE_NAME_SIZE];
+      char value[EXO_WORKER_VALUE_SIZE];
+    };
+
+    ExositeHTTP& _exosite;
+    ExoSpscQueue<Request, EXO_WORKER_QUEUE_DEPTH> _requests;
+    ExoSpscQueue<WorkerResult, EXO_WORKER_QUEUE_DEPTH> _results;
+    std::atomic<bool> _stop{false};
+
+    /**
+     * @brief Copies a request into the next free slot and publishes it
+     */
+    bool submit(const char* resource, const char* value, uint32_t tag) {
+      Request* request = _requests.back();
+      if (!request || !resource ||
+          strlen(resource) >= sizeof(request->resource) ||
+          (value && strlen(value) >= sizeof(request->value))) {
+        return false;
+      }
+
+      request->tag = tag;
+      request->isWrite = value != nullptr;
+      strcpy(request->resource, resource);
+      if (value) {
+        strcpy(request->value, value);
+      }
+
+      _requests.push();
+      return true;
+    }
+};
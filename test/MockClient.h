@@ -0,0 +1,77 @@
+// Scripted `Client` for host tests: records requests and serves queued responses
+#pragma once
+
+#include <Client.h>
+#include <deque>
+#include <string>
+
+struct MockClient : public Client {
+  std::string out;                   // Everything written by the library
+  std::deque<std::string> responses; // Queued responses (each served once new output was written)
+  std::string rx;                    // Response bytes not yet read
+  bool open = false;
+  bool refuse = false;               // Fail connection attempts
+  bool batch = false;                // Serve all queued responses at once (e.g. pipelined requests)
+  int connects = 0;
+  int stops = 0;
+  size_t served = 0;                 // Length of `out` when the last response was served
+
+  int connect(IPAddress, uint16_t) override { return connect("", 0); }
+  int connect(const char*, uint16_t) override {
+    if (refuse) return 0;
+    open = true;
+    connects++;
+    return 1;
+  }
+  size_t write(uint8_t c) override { out += (char)c; return 1; }
+  size_t write(const uint8_t* buf, size_t size) override { out.append((const char*)buf, size); return size; }
+
+  // A response is only released after a new request has been written
+  int available() override {
+    if (rx.empty() && out.size() != served && !responses.empty()) {
+      served = out.size();
+      do {
+        rx += responses.front();
+        responses.pop_front();
+      } while (batch && !responses.empty());
+    }
+    return rx.size();
+  }
+  int read() override {
+    if (!available()) return -1;
+    int c = (uint8_t)rx[0];
+    rx.erase(0, 1);
+    return c;
+  }
+  int read(uint8_t* buf, size_t size) override {
+    size_t i = 0;
+    while (i < size && available()) buf[i++] = read();
+    return i;
+  }
+  int peek() override { return available() ? (uint8_t)rx[0] : -1; }
+  void flush() override {}
+  void stop() override { open = false; rx.clear(); stops++; }
+  uint8_t connected() override { return open; }
+  operator bool() override { return open; }
+
+  // Queues a response with the given status line, extra headers, and body
+  void respond(const char* status, const std::string& body="", const char* headers="") {
+    responses.push_back(std::string("HTTP/1.1 ") + status + "\r\n" + headers +
+                        "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body);
+  }
+
+  // Counts the occurrences of a string in everything written
+  int count(const char* needle) {
+    int n = 0;
+    for (size_t pos = out.find(needle); pos != std::string::npos; pos = out.find(needle, pos + 1)) n++;
+    return n;
+  }
+
+  // Returns the last request written (from its request line)
+  std::string lastRequest() {
+    size_t get = out.rfind("GET ");
+    size_t post = out.rfind("POST ");
+    size_t start = (get == std::string::npos) ? post : (post == std::string::npos ? get : (get > post ? get : post));
+    return start == std::string::npos ? std::string() : out.substr(start);
+  }
+};
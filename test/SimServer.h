@@ -0,0 +1,356 @@
+// Stand-in Exosite server and simulated client connection, on the virtual clock of the host stubs
+//
+// Used by the fleet load generator (see: `loadgen.cpp`) and the benchmarks (see: `bench_*.cpp`)
+//
+// Note:
+//
+// - `SimClient` is event driven: while the library waits, `available()` advances the clock
+//   towards the time the server sends its response (by at most 5 ms per call, so library
+//   timeouts still apply at their simulated time)
+//
+// - The server serves requests on a fixed pool of workers (exponential service times per API),
+//   holds long polls without a worker, and closes connections idle for its keep-alive timeout;
+//   workers are assigned in the order requests are submitted, and the responses on a connection
+//   are received in the order of its requests (as for HTTP/1.1 pipelining)
+//
+// - Request bodies are accepted as-is or compressed (`Content-Encoding: deflate` or `gzip`), and
+//   written values are echoed by later reads; responses are compressed when accepted, if enabled
+//   (see: `LoadConfig::compressMin`)
+//
+// - The configuration is read as requests are served, so a run may change it (e.g. latency,
+//   service times, or `errorRate`) to inject a degradation
+#pragma once
+
+#include "ExositeHTTP.h"
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <map>
+#include <queue>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+enum LoadApi {
+  LOAD_PROVISION,
+  LOAD_TIMESTAMP,
+  LOAD_WRITE,
+  LOAD_READ,
+  LOAD_LONG_POLL,
+  LOAD_API_COUNT
+};
+
+static const char* const apiNames[LOAD_API_COUNT] = {"provision", "timestamp", "write", "read", "longPoll"};
+
+struct LoadConfig {
+  unsigned long seconds = 300;
+  unsigned long intervalMs = 15000;
+  unsigned int workers = 2;
+  unsigned long latencyMs = 20;
+  unsigned long keepAliveMs = 20000;
+  unsigned long pollTimeoutMs = 5000;
+  unsigned long updateMs = 30000;  // Mean time between updates of a polled value
+  double serviceMs[LOAD_API_COUNT] = {20, 0.2, 2, 1.5, 0};  // Long polls are held without a worker
+  size_t compressMin = 0;          // Min length (B) of response bodies compressed when accepted (0: never)
+  double errorRate = 0;            // Share of device API requests refused (HTTP 503)
+};
+
+static std::string findHeader(const std::string& request, const char* name) {
+  size_t pos = request.find(std::string("\r\n") + name);
+  if (pos == std::string::npos) {
+    return "";
+  }
+  pos += 2 + strlen(name);
+  return request.substr(pos, request.find("\r\n", pos) - pos);
+}
+
+static void appendSink(const uint8_t* data, size_t len, void* context) {
+  static_cast<std::string*>(context)->append((const char*)data, len);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+// Stand-in for the Exosite HTTP device API (provisioning, aliases, long polls, timestamp)
+class StandInServer {
+  public:
+    unsigned long requests = 0;
+    double busyMs = 0;   // Worker time requested (including past the end of the run)
+    double waitMs = 0;   // Time requests spent queued for a worker
+    unsigned long maxWaitMs = 0;
+    size_t requestBytes = 0;   // Request bodies, as received (i.e. compressed, if so)
+    size_t decodedBytes = 0;   // Request bodies, after decompression
+    size_t responseBytes = 0;  // Response bodies, as sent
+    unsigned long compressedRequests = 0;
+    unsigned long compressedResponses = 0;
+    unsigned long errors = 0;  // Requests refused (see: `LoadConfig::errorRate`)
+
+    StandInServer(const LoadConfig& config) : _config(config), _rng(1) {
+      for (unsigned int i = 0; i < config.workers; i++) {
+        _workers.push(0);
+      }
+    }
+
+    // Serves a complete request arriving at `arrival`, setting when its response is sent
+    std::string serve(const std::string& request, unsigned long arrival, unsigned long& done) {
+      std::string line = request.substr(0, request.find("\r\n"));
+      std::string body = request.substr(request.find("\r\n\r\n") + 4);
+      requests++;
+      requestBytes += body.size();
+      _accept = findHeader(request, "Accept-Encoding: ");
+
+      std::string encoding = findHeader(request, "Content-Encoding: ");
+      if (encoding == "deflate" || encoding == "gzip") {
+        std::string decoded(65536, '\0');
+        long len = ExositeDeflate::inflate((const uint8_t*)body.data(), body.size(), (uint8_t*)&decoded[0], decoded.size());
+        if (len < 0) {
+          done = arrival;
+          return response("400 Bad Request");
+        }
+        body = decoded.substr(0, len);
+        compressedRequests++;
+      }
+      else if (!encoding.empty() && encoding != "identity") {
+        done = arrival;
+        return response("415 Unsupported Media Type");
+      }
+      decodedBytes += body.size();
+
+      if (line.compare(0, 25, "POST /provision/activate ") == 0) {
+        done = process(LOAD_PROVISION, arrival);
+        std::string identity = body.compare(0, 3, "id=") == 0 ? body.substr(3) : "";
+        if (identity.empty()) {
+          return response("400 Bad Request");
+        }
+        if (!_identities.insert(identity).second) {
+          return response("409 Conflict");
+        }
+        char token[41];
+        for (int i = 0; i < 40; i++) {
+          token[i] = "0123456789abcdef"[_rng() & 0xF];
+        }
+        token[40] = '\0';
+        _tokens.insert(token);
+        return response("200 OK", token);
+      }
+
+      if (line.compare(0, 15, "GET /timestamp ") == 0) {
+        done = process(LOAD_TIMESTAMP, arrival);
+        return response("200 OK", std::to_string(1700000000UL + arrival / 1000));
+      }
+
+      if (line.find(" /onep:v1/stack/alias") == std::string::npos) {
+        done = arrival;
+        return response("404 Not Found");
+      }
+      if (!_tokens.count(findHeader(request, "Authorization: token "))) {
+        done = arrival;
+        return response("401 Unauthorized");
+      }
+      if (_config.errorRate > 0 && std::uniform_real_distribution<double>(0, 1)(_rng) < _config.errorRate) {
+        done = arrival;
+        errors++;
+        return response("503 Service Unavailable");
+      }
+
+      if (line.compare(0, 5, "POST ") == 0) {
+        done = process(LOAD_WRITE, arrival);
+        size_t separator = body.find('=');
+        if (separator == std::string::npos) {
+          return response("400 Bad Request");
+        }
+        _values[body.substr(0, separator)] = body.substr(separator + 1); // Kept encoded
+        return response("204 No Content");
+      }
+
+      size_t query = line.find('?') + 1;
+      std::string resource = line.substr(query, line.find(' ', query) - query);
+
+      std::string pollTimeout = findHeader(request, "Request-Timeout: ");
+      if (!pollTimeout.empty()) {
+        // Held until the value changes or the poll times out
+        unsigned long timeoutMs = strtoul(pollTimeout.c_str(), nullptr, 10);
+        unsigned long updateMs = (unsigned long)std::exponential_distribution<double>(1.0 / _config.updateMs)(_rng);
+        if (updateMs < timeoutMs) {
+          done = arrival + updateMs;
+          return response("200 OK", resource + "=on");
+        }
+        done = arrival + timeoutMs;
+        return response("304 Not Modified");
+      }
+
+      done = process(LOAD_READ, arrival);
+      auto value = _values.find(resource);
+      return response("200 OK", resource + "=" + (value != _values.end() ? value->second : std::to_string(arrival % 1000)));
+    }
+
+  private:
+    const LoadConfig& _config;
+    std::mt19937 _rng;
+    std::priority_queue<unsigned long, std::vector<unsigned long>, std::greater<unsigned long>> _workers;
+    std::set<std::string> _identities;
+    std::set<std::string> _tokens;
+    std::map<std::string, std::string> _values; // Written values, by alias
+    std::string _accept;                        // Accept-Encoding of the request being served
+
+    // Runs a request on the first free worker, returning when it completes
+    unsigned long process(LoadApi api, unsigned long arrival) {
+      double serviceMs = std::exponential_distribution<double>(1.0 / _config.serviceMs[api])(_rng);
+      unsigned long start = std::max(arrival, _workers.top());
+      unsigned long done = start + (unsigned long)(serviceMs + 0.5);
+      _workers.pop();
+      _workers.push(done);
+
+      busyMs += serviceMs;
+      waitMs += start - arrival;
+      maxWaitMs = std::max(maxWaitMs, start - arrival);
+      return done;
+    }
+
+    std::string response(const char* status, const std::string& body="") {
+      std::string headers;
+      std::string sent = body;
+      if (_config.compressMin && body.size() >= _config.compressMin && _accept.find("deflate") != std::string::npos) {
+        sent.clear();
+        ExositeDeflate deflate(appendSink, &sent);
+        deflate.compress((const uint8_t*)body.data(), body.size());
+        deflate.finish();
+        headers = "Content-Encoding: deflate\r\n";
+        compressedResponses++;
+      }
+      responseBytes += sent.size();
+      return std::string("HTTP/1.1 ") + status + "\r\n" + headers + "Content-Length: " + std::to_string(sent.size()) +
+             "\r\n\r\n" + sent;
+    }
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+// Connection of one device to the stand-in server, on the simulated clock
+class SimClient : public Client {
+  public:
+    unsigned long connects = 0;
+    unsigned long serverCloses = 0;
+
+    SimClient(StandInServer& server, const LoadConfig& config) : _server(server), _config(config) {}
+
+    int connect(IPAddress, uint16_t) override {
+      return connect("", 0);
+    }
+
+    int connect(const char*, uint16_t) override {
+      stop();
+      connects++;
+      g_millis += 3 * _config.latencyMs; // TCP and TLS handshakes (1.5 round trips)
+      _open = true;
+      _idleSince = g_millis;
+      return 1;
+    }
+
+    size_t write(uint8_t c) override {
+      return write(&c, 1);
+    }
+
+    size_t write(const uint8_t* buf, size_t size) override {
+      if (!connected()) {
+        return 0;
+      }
+      _tx.append((const char*)buf, size);
+      _idleSince = g_millis;
+      submit();
+      return size;
+    }
+
+    int available() override {
+      unsigned long now = g_millis;
+      while (!_pending.empty() && _pending.front().first <= now) {
+        _rx += _pending.front().second;
+        _idleSince = _pending.front().first;
+        _pending.pop_front();
+      }
+
+      // Nothing to read yet: move the clock on, up to the next response
+      if (_rx.empty()) {
+        g_millis += _pending.empty() ? 1 : std::min(_pending.front().first - now, 5UL);
+      }
+      return _rx.size();
+    }
+
+    int read() override {
+      if (!available()) {
+        return -1;
+      }
+      int c = (uint8_t)_rx[0];
+      _rx.erase(0, 1);
+      return c;
+    }
+
+    int read(uint8_t* buf, size_t size) override {
+      size_t count = 0;
+      while (count < size && available()) {
+        buf[count++] = read();
+      }
+      return count;
+    }
+
+    int peek() override {
+      return available() ? (uint8_t)_rx[0] : -1;
+    }
+
+    void flush() override {}
+
+    void stop() override {
+      _open = false;
+      _tx.clear();
+      _rx.clear();
+      _pending.clear();
+    }
+
+    uint8_t connected() override {
+      if (_open && _pending.empty() && _rx.empty() && g_millis - _idleSince >= _config.keepAliveMs) {
+        _open = false; // Closed by the server while idle
+        serverCloses++;
+      }
+      return _open || !_rx.empty();
+    }
+
+    operator bool() override {
+      return _open;
+    }
+
+  private:
+    StandInServer& _server;
+    const LoadConfig& _config;
+    bool _open = false;
+    unsigned long _idleSince = 0;
+    std::string _tx;                                            // Request bytes not yet complete
+    std::string _rx;                                            // Response bytes received
+    std::deque<std::pair<unsigned long, std::string>> _pending; // Responses in flight (arrival time)
+
+    // Passes each complete request to the server
+    void submit() {
+      while (true) {
+        // Empty lines between requests are ignored (e.g. the line ending after a body)
+        size_t start = 0;
+        while (_tx.compare(start, 2, "\r\n") == 0) {
+          start += 2;
+        }
+        _tx.erase(0, start);
+
+        size_t headerEnd = _tx.find("\r\n\r\n");
+        if (headerEnd == std::string::npos) {
+          return;
+        }
+        size_t length = headerEnd + 4 + strtoul(findHeader(_tx.substr(0, headerEnd + 2), "Content-Length: ").c_str(), nullptr, 10);
+        if (_tx.size() < length) {
+          return;
+        }
+
+        unsigned long done;
+        std::string response = _server.serve(_tx.substr(0, length), g_millis + _config.latencyMs, done);
+        _pending.emplace_back(done + _config.latencyMs, response);
+        _tx.erase(0, length);
+      }
+    }
+};
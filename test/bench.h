@@ -0,0 +1,21 @@
+// Host timing for benchmarks (see: `bench_*.cpp`)
+#pragma once
+
+#include <chrono>
+
+// Host time (us) of one call of `run`, averaged over enough calls to take ~50 ms
+template <typename F>
+static double timeUs(F run) {
+  typedef std::chrono::steady_clock clock;
+  unsigned long calls = 0;
+  clock::time_point start = clock::now();
+  double elapsedUs;
+  do {
+    for (int i = 0; i < 16; i++) {
+      run();
+    }
+    calls += 16;
+    elapsedUs = std::chrono::duration<double, std::micro>(clock::now() - start).count();
+  } while (elapsedUs < 50000);
+  return elapsedUs / calls;
+}
@@ -0,0 +1,220 @@
+// Benchmark: channel payload writer vs. the JSONVar path (heap allocations, peak heap, and time)
+//
+// Usage: make -C test bench                 (all benchmarks)
+//        test/build/bench_channels
+//
+// Note:
+//
+// - Each cycle sends the example sketch's payload (4 inputs and the potentiometer), either built
+//   with `beginChannels()`/`addChannel()`/`writeChannels()`, or as the sketch did before: a
+//   `JSONVar` object, `JSON.stringify()`, then `write(String, String)`
+//
+// - Arduino_JSON is not available on the host, so its path is modeled on what it does: a cJSON
+//   node and a copy of the key per member (`malloc()`), printing numbers with `%1.15g` (or `%1.17g`
+//   if that does not round-trip) into a growing buffer, then copying it into a `String`
+//
+// - Allocations are counted through `new` and the wrapped `malloc()` family (see: Makefile), and
+//   peak heap is the most live bytes (as allocated by the host's `malloc()`) during a cycle; times
+//   are those of the host, so only their ratio carries over to a device
+
+#include "ExositeHTTP.h"
+#include "bench.h"
+
+#include <algorithm>
+#include <malloc.h>
+#include <new>
+#include <stdlib.h>
+
+static unsigned long allocations = 0;
+static size_t liveBytes = 0;
+static size_t peakBytes = 0;
+
+extern "C" {
+  void* __real_malloc(size_t size);
+  void* __real_calloc(size_t count, size_t size);
+  void* __real_realloc(void* ptr, size_t size);
+  void __real_free(void* ptr);
+
+  static void* tracked(void* ptr) {
+    if (ptr) {
+      allocations++;
+      liveBytes += malloc_usable_size(ptr);
+      peakBytes = std::max(peakBytes, liveBytes);
+    }
+    return ptr;
+  }
+
+  void* __wrap_malloc(size_t size) { return tracked(__real_malloc(size)); }
+  void* __wrap_calloc(size_t count, size_t size) { return tracked(__real_calloc(count, size)); }
+  void* __wrap_realloc(void* ptr, size_t size) {
+    liveBytes -= ptr ? malloc_usable_size(ptr) : 0;
+    return tracked(__real_realloc(ptr, size));
+  }
+  void __wrap_free(void* ptr) {
+    liveBytes -= ptr ? malloc_usable_size(ptr) : 0;
+    __real_free(ptr);
+  }
+}
+
+void* operator new(size_t size) {
+  void* ptr = __wrap_malloc(size ? size : 1);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* ptr) noexcept { __wrap_free(ptr); }
+void operator delete[](void* ptr) noexcept { __wrap_free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { __wrap_free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { __wrap_free(ptr); }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+// Minimal model of a `JSONVar` object of numbers (a cJSON object: linked nodes, keys copied)
+class JsonModel {
+  public:
+    ~JsonModel() {
+      while (_head) {
+        Node* next = _head->next;
+        free(_head->key);
+        free(_head);
+        _head = next;
+      }
+    }
+
+    // As `json[key] = value` (a node, and a copy of the key)
+    void set(const char* key, double value) {
+      Node* node = (Node*)malloc(sizeof(Node));
+      node->key = (char*)malloc(strlen(key) + 1);
+      strcpy(node->key, key);
+      node->value = value;
+      node->next = nullptr;
+      *(_tail ? &_tail->next : &_head) = node;
+      _tail = node;
+    }
+
+    // As `JSON.stringify(json)` (printed into a growing buffer, then copied into a `String`)
+    String stringify() const {
+      size_t size = 256, length = 0;
+      char* buffer = (char*)malloc(size);
+      buffer[length++] = '{';
+      for (Node* node = _head; node; node = node->next) {
+        char number[32];
+        snprintf(number, sizeof(number), "%1.15g", node->value);
+        if (strtod(number, nullptr) != node->value) {
+          snprintf(number, sizeof(number), "%1.17g", node->value);
+        }
+        size_t needed = length + strlen(node->key) + strlen(number) + 5;
+        if (needed > size) {
+          size *= 2;
+          buffer = (char*)realloc(buffer, size);
+        }
+        length += sprintf(buffer + length, "%s\"%s\":%s", node == _head ? "" : ",", node->key, number);
+      }
+      strcpy(buffer + length, "}");
+      String result(buffer);
+      free(buffer);
+      return result;
+    }
+
+  private:
+    struct Node {
+      char* key;
+      double value;
+      Node* next;
+    };
+    Node* _head = nullptr;
+    Node* _tail = nullptr;
+};
+
+// Client with fixed buffers (answers every request with a 204, counting what is written)
+struct FixedClient : public Client {
+  const char* response = "HTTP/1.1 204 No Content\r\nContent-Length: 0\r\n\r\n";
+  size_t pos = 0;
+  size_t written = 0;
+  bool open = false;
+  bool pending = false;
+
+  int connect(IPAddress, uint16_t) override { return connect("", 0); }
+  int connect(const char*, uint16_t) override { open = true; return 1; }
+  size_t write(uint8_t) override { return write(nullptr, 1); }
+  size_t write(const uint8_t*, size_t size) override {
+    written += size;
+    if (!pending) { pending = true; pos = 0; }
+    return size;
+  }
+  int available() override { return pending ? strlen(response) - pos : 0; }
+  int read() override {
+    if (!available()) return -1;
+    int c = (uint8_t)response[pos++];
+    if (!response[pos]) pending = false;
+    return c;
+  }
+  int read(uint8_t* buf, size_t size) override {
+    size_t i = 0;
+    while (i < size && available()) buf[i++] = read();
+    return i;
+  }
+  int peek() override { return available() ? (uint8_t)response[pos] : -1; }
+  void flush() override {}
+  void stop() override { open = false; pending = false; }
+  uint8_t connected() override { return open; }
+  operator bool() override { return open; }
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static const int inputs[4] = {1, 0, 1, 0};
+static const float potentiometer = 2.41f;
+static const String dataResource = "data_in";
+
+static bool sendJsonVar(ExositeHTTP& exosite) {
+  JsonModel json;
+  json.set("001", inputs[0]);
+  json.set("002", inputs[1]);
+  json.set("003", inputs[2]);
+  json.set("004", inputs[3]);
+  json.set("005", potentiometer);
+  String payload = json.stringify();
+  return exosite.write(dataResource, payload).success;
+}
+
+static bool sendChannels(ExositeHTTP& exosite) {
+  exosite.beginChannels();
+  return exosite.addChannel("001", inputs[0]) &&
+         exosite.addChannel("002", inputs[1]) &&
+         exosite.addChannel("003", inputs[2]) &&
+         exosite.addChannel("004", inputs[3]) &&
+         exosite.addChannel("005", potentiometer, 2) &&
+         exosite.writeChannels(dataResource.c_str()).success;
+}
+
+static void printPath(const char* name, bool (*send)(ExositeHTTP&)) {
+  FixedClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  if (!send(exosite)) { // Connects (and warms up) outside of the measurements
+    fprintf(stderr, "%s: request failed\n", name);
+    exit(1);
+  }
+
+  unsigned long before = allocations;
+  size_t written = client.written;
+  size_t baseBytes = liveBytes;
+  peakBytes = liveBytes;
+  send(exosite);
+  unsigned long cycleAllocations = allocations - before;
+  size_t cycleWritten = client.written - written;
+  size_t cyclePeak = peakBytes - baseBytes;
+
+  double us = timeUs([&] { send(exosite); });
+  printf("%-10s %12lu %12zu %12zu %12.2f\n", name, cycleAllocations, cyclePeak, cycleWritten, us);
+}
+
+int main() {
+  g_millisStep = 0;
+
+  printf("Example data_in payload per cycle (a request answered by a 204, on the host)\n\n");
+  printf("%-10s %12s %12s %12s %12s\n", "path", "allocations", "peak heap B", "request B", "us/cycle");
+  printPath("JSONVar", sendJsonVar);
+  printPath("channels", sendChannels);
+  return 0;
+}
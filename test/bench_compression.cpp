@@ -0,0 +1,181 @@
+// Benchmark: compression ratio and CPU cost of request bodies, on realistic channel configurations
+//
+// Usage: make -C test bench                           (all benchmarks)
+//        test/build/bench_compression [channels ...]  (generated configs, default: 16 64 256)
+//
+// Note:
+//
+// - Configurations follow the example sketch's `CHANNEL_CONFIG` (minified, as `JSON.stringify()`
+//   sends it), which is measured first, then generated ones with more channels of mixed types
+//
+// - Bodies are `config_io=<URL-encoded JSON>`, compressed as `setCompression()` sends them
+//   (the prefix as literals, the value searched for matches); CPU times are those of the host,
+//   so only their relative cost (vs. the body length) carries over to a device
+//
+// - The stand-in server (see: `SimServer.h`) inflates compressed writes, and echoes the written
+//   value on read, compressed when the device accepts it; a compressed response is inflated
+//   within the internal buffer, so it must still fit there once decompressed (with its headers)
+
+#include "ExositeHTTP.h"
+#include "ExositeLog.h"
+#include "SimServer.h"
+#include "bench.h"
+#include "../examples/Exosite_IoT_Opta_PLC_Ethernet/cloud_config.h"
+
+// Removes the whitespace outside of strings (as `JSON.stringify(JSON.parse(...))`)
+static std::string minify(const char* json) {
+  std::string result;
+  bool inString = false;
+  for (const char* c = json; *c; c++) {
+    if (*c == '"' && (c == json || c[-1] != '\\')) {
+      inString = !inString;
+    }
+    if (inString || !isspace((unsigned char)*c)) {
+      result += *c;
+    }
+  }
+  return result;
+}
+
+// Channel configuration of the given number of channels, cycling through typical channel types
+static std::string channelConfig(unsigned int channels) {
+  static const char* const types[][2] = {
+    {"Input", "\"data_type\":\"BOOLEAN\""},
+    {"Voltage", "\"data_type\":\"ELEC_POTENTIAL\",\"data_unit\":\"VOLT\",\"precision\":2"},
+    {"Temperature", "\"data_type\":\"TEMPERATURE\",\"data_unit\":\"DEG_CELSIUS\",\"precision\":1"},
+    {"Current", "\"data_type\":\"ELEC_CURRENT\",\"data_unit\":\"AMPERE\",\"precision\":3"},
+  };
+
+  std::string json = "{\"channels\":{";
+  for (unsigned int i = 0; i < channels; i++) {
+    char id[12];
+    snprintf(id, sizeof(id), "%03u", i + 1);
+    const char* const* type = types[i % 4];
+    json += std::string(i ? "," : "") + "\"" + id + "\":{\"display_name\":\"" + type[0] + " " +
+            std::to_string(i / 4 + 1) + "\",\"properties\":{" + type[1] +
+            "},\"protocol_config\":{\"report_rate\":" + std::to_string(i % 3 ? 10000 : 60000) + "}}";
+  }
+  return json + "}}";
+}
+
+// URL-encodes as the library does (see: `ExositeHTTP::encodeChar()`)
+static std::string urlEncode(const std::string& text, UrlEncoding encoding) {
+  std::string result;
+  for (char c : text) {
+    if (isalnum((unsigned char)c) || c == '-' || c == '_' || c == '.' || c == '~' ||
+        (encoding == URL_ENCODING_MINIMAL && c > ' ' && c < 0x7F && c != '&' && c != '=' && c != '+' && c != '%')) {
+      result += c;
+    }
+    else if (c == ' ') {
+      result += '+';
+    }
+    else {
+      char escaped[4];
+      snprintf(escaped, sizeof(escaped), "%%%02X", (uint8_t)c);
+      result += escaped;
+    }
+  }
+  return result;
+}
+
+// Compresses a `key=value` body as the library does, returning the compressed length
+static size_t compressBody(const std::string& value) {
+  ExositeDeflate deflate(nullptr);
+  deflate.literals((const uint8_t*)"config_io=", 10);
+  deflate.compress((const uint8_t*)value.data(), value.size());
+  return deflate.finish();
+}
+
+static void printCodec(const char* name, const std::string& json) {
+  for (UrlEncoding encoding : {URL_ENCODING_STRICT, URL_ENCODING_MINIMAL}) {
+    std::string value = urlEncode(json, encoding);
+    size_t bodyLen = 10 + value.size();
+    std::string compressed;
+    ExositeDeflate deflate(appendSink, &compressed);
+    deflate.literals((const uint8_t*)"config_io=", 10);
+    deflate.compress((const uint8_t*)value.data(), value.size());
+    size_t compressedLen = deflate.finish();
+    std::string inflated(bodyLen, '\0');
+    if (ExositeDeflate::inflate((const uint8_t*)compressed.data(), compressed.size(), (uint8_t*)&inflated[0],
+                                inflated.size()) != (long)bodyLen || inflated != "config_io=" + value) {
+      fprintf(stderr, "Round trip failed: %s\n", name);
+      exit(1);
+    }
+
+    double compressUs = timeUs([&] { compressBody(value); });
+    double inflateUs = timeUs([&] {
+      ExositeDeflate::inflate((const uint8_t*)compressed.data(), compressed.size(), (uint8_t*)&inflated[0], inflated.size());
+    });
+
+    printf("%-14s %-7s %7zu %7zu %7zu %6.1f%% %9.1f %9.1f %9.1f\n",
+           name, encoding == URL_ENCODING_STRICT ? "strict" : "minimal", json.size(), bodyLen, compressedLen,
+           100.0 * compressedLen / bodyLen, compressUs, inflateUs, bodyLen / compressUs);
+  }
+}
+
+// Writes the configuration through the library to the stand-in, then reads it back
+static void printRoundTrip(const LoadConfig& config, const std::string& json, UrlEncoding encoding, bool compress) {
+  g_millis = 0;
+  StandInServer server(config);
+  SimClient client(server, config);
+  ExositeHTTP exosite(&client, "bench.m2.exosite.io");
+
+  char token[64];
+  if (!exosite.provision("bench-1", token, sizeof(token)).success) {
+    fprintf(stderr, "Failed to provision\n");
+    exit(1);
+  }
+  exosite.setToken(token);
+  exosite.setEncoding(encoding);
+  exosite.setCompression(compress);
+
+  size_t requestBytes = server.requestBytes;
+  bool written = exosite.write("config_io", json.c_str()).success;
+  requestBytes = server.requestBytes - requestBytes;
+
+  static char echo[4096];
+  size_t responseBytes = server.responseBytes;
+  bool echoed = written && exosite.read("config_io", echo, sizeof(echo)).success && json == echo;
+  responseBytes = server.responseBytes - responseBytes;
+
+  printf("%-7s %-5s %8zu %10zu  %s\n", encoding == URL_ENCODING_STRICT ? "strict" : "minimal",
+         compress ? "on" : "off", requestBytes, responseBytes,
+         !written ? "write failed" : echoed ? "ok" : "read failed");
+}
+
+int main(int argc, char** argv) {
+  LoadConfig config;
+  config.compressMin = 64;
+  std::vector<unsigned int> channels;
+
+  for (int i = 1; i < argc; i++) {
+    channels.push_back(strtoul(argv[i], nullptr, 10));
+  }
+  if (channels.empty()) {
+    channels = {16, 64, 256};
+  }
+
+  ExositeLog::setOutput(nullptr); // Failures are reported in the results
+  g_millisStep = 0;                // Time only advances while waiting (see: `SimClient`)
+
+  std::string example = minify(CHANNEL_CONFIG);
+
+  printf("Compression of config_io bodies (ratio: compressed / body; CPU: host time per body)\n\n");
+  printf("%-14s %-7s %7s %7s %7s %7s %9s %9s %9s\n",
+         "config", "encode", "json B", "body B", "wire B", "ratio", "deflate us", "inflate us", "B/us");
+  printCodec("example (5 ch)", example);
+  for (unsigned int count : channels) {
+    char name[16];
+    snprintf(name, sizeof(name), "%u channels", count);
+    printCodec(name, channelConfig(count));
+  }
+
+  printf("\nExample config written and read back through the stand-in server "
+         "(responses compressed from %zu B, internal buffer %d B)\n\n", config.compressMin, EXO_DATA_BUFFER_SIZE);
+  printf("%-7s %-5s %8s %10s  %s\n", "encode", "comp", "sent B", "received B", "echo");
+  for (UrlEncoding encoding : {URL_ENCODING_STRICT, URL_ENCODING_MINIMAL}) {
+    printRoundTrip(config, example, encoding, false);
+    printRoundTrip(config, example, encoding, true);
+  }
+  return 0;
+}
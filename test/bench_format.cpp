@@ -0,0 +1,145 @@
+// Benchmark: numeric formatting (`formatNumber()`, `formatInteger()`) vs. the printf-based paths
+//
+// Usage: make -C test bench                   (all benchmarks)
+//        test/build/bench_format [precision]  (decimal places of the float values, default: 2)
+//
+// Note:
+//
+// - Values are typical telemetry: voltages (0-10 V) and temperatures (-20-60 degC) read as
+//   `float` (as `readAnalogInputs()`), and counters (0-1e6) as `long`
+//
+// - The paths compared are those a channel value took before `addChannel()`: `String(value, 2)`
+//   (i.e. `dtostrf()`, `%.2f`), `Print::printFloat()` (digit by digit, in floating point), and
+//   `JSONVar` (cJSON: `%1.15g`, or `%1.17g` if that does not round-trip)
+//
+// - Times are those of the host (with a hardware FPU and an optimized `printf()`), so only their
+//   ratio carries over to a device; sizes are the mean length of the formatted values
+
+#include "ExositeHTTP.h"
+#include "bench.h"
+
+#include <random>
+#include <vector>
+
+// As Arduino's `Print::printFloat()`, into a buffer
+static size_t printFloat(double number, unsigned int digits, char* dest) {
+  char* out = dest;
+  if (number < 0.0) {
+    *out++ = '-';
+    number = -number;
+  }
+
+  double rounding = 0.5;
+  for (unsigned int i = 0; i < digits; i++) {
+    rounding /= 10.0;
+  }
+  number += rounding;
+
+  unsigned long integer = (unsigned long)number;
+  double remainder = number - (double)integer;
+  out += sprintf(out, "%lu", integer);
+  if (digits > 0) {
+    *out++ = '.';
+  }
+  while (digits-- > 0) {
+    remainder *= 10.0;
+    unsigned int digit = (unsigned int)remainder;
+    *out++ = '0' + digit;
+    remainder -= digit;
+  }
+  *out = '\0';
+  return out - dest;
+}
+
+// As cJSON's number printing (used by `JSON.stringify()`)
+static size_t printJson(double number, char* dest) {
+  int length = snprintf(dest, 32, "%1.15g", number);
+  if (strtod(dest, nullptr) != number) {
+    length = snprintf(dest, 32, "%1.17g", number);
+  }
+  return length;
+}
+
+struct Result {
+  double ns;
+  double bytes;
+};
+
+template <typename T, typename F>
+static Result measure(const std::vector<T>& values, F format) {
+  char buffer[40];
+  size_t total = 0;
+  for (T value : values) {
+    total += format(value, buffer);
+  }
+
+  volatile size_t sink = 0;
+  double us = timeUs([&] {
+    for (T value : values) {
+      sink += format(value, buffer);
+    }
+  });
+  (void)sink;
+  return {1000.0 * us / values.size(), (double)total / values.size()};
+}
+
+static void printResult(const char* name, const Result& result, const Result& baseline) {
+  printf("%-34s %8.1f %8.2f %8.1fx\n", name, result.ns, result.bytes, baseline.ns / result.ns);
+}
+
+int main(int argc, char** argv) {
+  unsigned int precision = argc > 1 ? strtoul(argv[1], nullptr, 10) : 2;
+
+  std::mt19937 rng(1);
+  std::vector<float> floats;
+  std::vector<long> integers;
+  for (int i = 0; i < 1024; i++) {
+    floats.push_back(i % 2 ? std::uniform_real_distribution<float>(0, 10)(rng)
+                           : std::uniform_real_distribution<float>(-20, 60)(rng));
+    integers.push_back(std::uniform_int_distribution<long>(0, 1000000)(rng));
+  }
+
+  char format[8];
+  snprintf(format, sizeof(format), "%%.%uf", precision);
+
+  printf("Formatting %zu float values (precision %u) and %zu integers, on the host\n\n",
+         floats.size(), precision, integers.size());
+  printf("%-34s %8s %8s %9s\n", "path", "ns/value", "bytes", "speedup");
+
+  Result printfFloat = measure(floats, [&](float value, char* dest) {
+    return (size_t)snprintf(dest, 40, format, value);
+  });
+  printResult("snprintf / dtostrf / String(v, p)", printfFloat, printfFloat);
+  printResult("Print::printFloat", measure(floats, [&](float value, char* dest) {
+    return printFloat(value, precision, dest);
+  }), printfFloat);
+  printResult("JSONVar (%1.15g / %1.17g)", measure(floats, [](float value, char* dest) {
+    return printJson(value, dest);
+  }), printfFloat);
+  printResult("formatNumber (fixed)", measure(floats, [&](float value, char* dest) {
+    return ExositeHTTP::formatNumber(value, precision, dest);
+  }), printfFloat);
+  printResult("formatNumber (shortest)", measure(floats, [&](float value, char* dest) {
+    return ExositeHTTP::formatNumber(value, precision, dest, NUMBER_FORMAT_SHORTEST);
+  }), printfFloat);
+
+  // Fixed output matches printf's (but where a value is within rounding error of a halfway case)
+  unsigned int matches = 0;
+  for (float value : floats) {
+    char expected[40], actual[40];
+    snprintf(expected, sizeof(expected), format, value);
+    ExositeHTTP::formatNumber(value, precision, actual);
+    matches += strcmp(expected, actual) == 0;
+  }
+  printf("%-34s %u of %zu values as snprintf\n", "", matches, floats.size());
+
+  printf("\n");
+  Result printfInteger = measure(integers, [](long value, char* dest) {
+    return (size_t)snprintf(dest, 40, "%ld", value);
+  });
+  printResult("snprintf (%ld)", printfInteger, printfInteger);
+  printResult("formatInteger", measure(integers, [](long value, char* dest) {
+    return ExositeHTTP::formatInteger(value, dest);
+  }), printfInteger);
+  return 0;
+}
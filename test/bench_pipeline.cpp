@@ -0,0 +1,132 @@
+// Benchmark: pipelined vs. sequential requests over one connection, against a stand-in server
+//
+// Usage: make -C test bench                                (all benchmarks)
+//        test/build/bench_pipeline [options] [latency ...]  (one-way ms, default: 5 20 50 100 250)
+//
+//   -n requests  Requests per run (default: 400)
+//   -w workers   Server workers (default: 2)
+//
+// Note:
+//
+// - Each run sends the same requests (3 writes, then a read of `data_out`, repeated) from one
+//   device, either one call at a time or in pipelines of `EXO_PIPELINE_DEPTH` requests
+//
+// - Times are simulated (see: `SimServer.h`), so throughput is that of the link and server,
+//   not of the host
+//
+// - Sequential calls also include the ~100 ms that `readHttpResponse()` waits for trailing data
+//   after each response, which pipelined (length-framed) responses avoid
+
+#include "ExositeHTTP.h"
+#include "ExositeLog.h"
+#include "SimServer.h"
+
+struct RunResult {
+  unsigned long requests = 0;
+  unsigned long failures = 0;
+  unsigned long elapsedMs = 0;
+  unsigned long connects = 0;
+};
+
+// Values written by the requests of a group (kept valid until the end of a pipeline)
+static const char* const values[] = {"{\"001\":1}", "{\"001\":2}", "{\"001\":3}"};
+static const size_t groupSize = 4;
+
+static RunResult runRequests(const LoadConfig& config, unsigned long requests, bool pipelined) {
+  g_millis = 0;
+  StandInServer server(config);
+  SimClient client(server, config);
+  ExositeHTTP exosite(&client, "bench.m2.exosite.io");
+
+  char token[64];
+  if (!exosite.provision("bench-1", token, sizeof(token)).success) {
+    fprintf(stderr, "Failed to provision\n");
+    exit(1);
+  }
+  exosite.setToken(token);
+
+  RunResult result;
+  unsigned long start = g_millis;
+  unsigned long connects = client.connects;
+  char value[64];
+
+  while (result.requests < requests) {
+    if (pipelined) {
+      ApiResponse results[EXO_PIPELINE_DEPTH];
+      exosite.beginPipeline();
+      for (size_t i = 0; i < EXO_PIPELINE_DEPTH && result.requests + i < requests; i++) {
+        size_t index = (result.requests + i) % groupSize;
+        if (index < groupSize - 1) {
+          exosite.pipelineWrite("data_in", values[index]);
+        }
+        else {
+          exosite.pipelineRead("data_out");
+        }
+      }
+      size_t count = exosite.endPipeline(results, EXO_PIPELINE_DEPTH);
+      for (size_t i = 0; i < count; i++) {
+        result.failures += !results[i].success;
+      }
+      result.requests += count;
+    }
+    else {
+      size_t index = result.requests % groupSize;
+      ApiResponse res = (index < groupSize - 1) ? exosite.write("data_in", values[index])
+                                                : exosite.read("data_out", value, sizeof(value));
+      result.failures += !res.success;
+      result.requests++;
+    }
+  }
+
+  result.elapsedMs = g_millis - start;
+  result.connects = client.connects - connects;
+  return result;
+}
+
+static void printResult(unsigned long latencyMs, const char* mode, const RunResult& result, double speedup) {
+  printf("%10lu  %-10s %8lu %8lu %10.1f %10.1f %8lu %8.2fx\n",
+         latencyMs, mode, result.requests, result.failures,
+         1000.0 * result.requests / result.elapsedMs, (double)result.elapsedMs / result.requests,
+         result.connects, speedup);
+}
+
+int main(int argc, char** argv) {
+  LoadConfig config;
+  unsigned long requests = 400;
+  std::vector<unsigned long> latencies;
+
+  for (int i = 1; i < argc; i++) {
+    if (argv[i][0] == '-' && i + 1 < argc) {
+      unsigned long value = strtoul(argv[++i], nullptr, 10);
+      switch (argv[i - 1][1]) {
+        case 'n': requests = value > 0 ? value : 1; break;
+        case 'w': config.workers = value > 0 ? value : 1; break;
+        default:
+          fprintf(stderr, "Unknown option: %s\n", argv[i - 1]);
+          return 2;
+      }
+    }
+    else {
+      latencies.push_back(strtoul(argv[i], nullptr, 10));
+    }
+  }
+  if (latencies.empty()) {
+    latencies = {5, 20, 50, 100, 250};
+  }
+
+  ExositeLog::setOutput(nullptr); // Failures are counted rather than logged
+  g_millisStep = 0;                // Time only advances while waiting (see: `SimClient`)
+
+  printf("Pipelined vs. sequential: %lu requests per run (3 writes, 1 read), pipeline depth %d, %u workers\n\n",
+         requests, EXO_PIPELINE_DEPTH, config.workers);
+  printf("%10s  %-10s %8s %8s %10s %10s %8s %9s\n",
+         "latency ms", "mode", "requests", "failed", "req/s", "ms/req", "connects", "speedup");
+  for (unsigned long latencyMs : latencies) {
+    config.latencyMs = latencyMs;
+    RunResult sequential = runRequests(config, requests, false);
+    RunResult pipelined = runRequests(config, requests, true);
+    printResult(latencyMs, "sequential", sequential, 1.0);
+    printResult(latencyMs, "pipelined", pipelined, (double)sequential.elapsedMs / pipelined.elapsedMs);
+  }
+  return 0;
+}
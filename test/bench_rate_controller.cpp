@@ -0,0 +1,228 @@
+// Benchmark: fixed-interval reporting vs. the adaptive rate controller, through a degradation
+//
+// Usage: make -C test bench                         (all benchmarks)
+//        test/build/bench_rate_controller [options]
+//
+//   -d devices  Devices reporting to the stand-in server (default: 2000)
+//   -i ms       Report interval of the fixed loop, and min interval of the controller (default: 10000)
+//   -t seconds  Duration of each phase: normal, degraded, recovered (default: 300)
+//   -l ms       One-way latency while degraded (default: 300, otherwise 20)
+//   -e percent  Requests refused (HTTP 503) while degraded (default: 5)
+//   -s factor   Slowdown of the server's service times while degraded (default: 10)
+//   -m factor   Max interval of the controller, as a multiple of the interval (default: 4)
+//   -a ms       Additive step of the controller (default: the interval)
+//
+// Note:
+//
+// - Devices run on the virtual clock against the stand-in server (see: `loadgen.cpp`,
+//   `SimServer.h`); while degraded, the fixed loop offers more requests than the server serves
+//
+// - The fixed loop writes, then waits the interval (as the example's `LOOP_DELAY`); with the
+//   controller, each result is fed to `ExositeRateController::update()` (with `lastRoundTrip()`)
+//   and the next write waits `interval()`, which only grows above the fixed interval under
+//   congestion
+//
+// - Recovery is the time after the degradation ends until a 10 s period has < 1% failures and a
+//   p90 latency within twice that of the normal phase
+
+#include "ExositeHTTP.h"
+#include "ExositeLog.h"
+#include "ExositeRateController.h"
+#include "SimServer.h"
+
+#include <memory>
+
+struct Device {
+  SimClient client;
+  ExositeHTTP exosite;
+  ExositeRateController rate;
+  char identity[16];
+  bool provisioned = false;
+
+  Device(StandInServer& server, const LoadConfig& config, unsigned int index, unsigned long intervalMs,
+         unsigned long maxIntervalMs, unsigned long stepMs)
+      : client(server, config), exosite(&client, "bench.m2.exosite.io"), rate(intervalMs, maxIntervalMs, 1) {
+    snprintf(identity, sizeof(identity), "rc-%06u", index);
+    rate.setTargetLatency(500);
+    rate.setStep(stepMs);
+  }
+};
+
+struct PeriodResults {
+  std::vector<unsigned long> latencies;
+  unsigned long failures = 0;
+};
+
+enum Phase { PHASE_NORMAL, PHASE_DEGRADED, PHASE_RECOVERED, PHASE_COUNT };
+static const char* const phaseNames[PHASE_COUNT] = {"normal", "degraded", "recovered"};
+
+struct Controller {
+  unsigned long maxFactor = 4; // Max interval, as a multiple of the fixed interval
+  unsigned long stepMs = 0;    // Additive step (0: the fixed interval)
+};
+
+struct Degradation {
+  unsigned long phaseMs = 300000;
+  unsigned long latencyMs = 300;
+  double errorRate = 0.05;
+  double slowdown = 10;
+};
+
+static const unsigned long periodMs = 10000;
+
+static unsigned long percentile(std::vector<unsigned long> latencies, double p) {
+  if (latencies.empty()) {
+    return 0;
+  }
+  std::sort(latencies.begin(), latencies.end());
+  return latencies[std::min(latencies.size() - 1, (size_t)(p * latencies.size()))];
+}
+
+static void runFleet(unsigned int deviceCount, unsigned long intervalMs, const Degradation& degradation,
+                     const Controller* controller) {
+  bool adaptive = controller != nullptr;
+  LoadConfig normal;
+  normal.serviceMs[LOAD_PROVISION] = normal.serviceMs[LOAD_WRITE]; // Not a start-up burst
+  LoadConfig config = normal; // Changed by phase (read by the server and clients as they serve)
+  g_millis = 0;
+  StandInServer server(config);
+  std::mt19937 rng(deviceCount);
+  std::uniform_real_distribution<double> uniform(0, 1);
+
+  std::vector<std::unique_ptr<Device>> devices;
+  typedef std::pair<unsigned long, unsigned int> Event; // Next write (ms), device
+  std::priority_queue<Event, std::vector<Event>, std::greater<Event>> schedule;
+  for (unsigned int i = 0; i < deviceCount; i++) {
+    devices.emplace_back(new Device(server, config, i, intervalMs, adaptive ? controller->maxFactor * intervalMs : intervalMs,
+                                    adaptive && controller->stepMs ? controller->stepMs : intervalMs));
+    schedule.push(Event((unsigned long)(uniform(rng) * intervalMs), i));
+  }
+
+  const unsigned long endMs = PHASE_COUNT * degradation.phaseMs;
+  std::vector<PeriodResults> periods(endMs / periodMs);
+  PeriodResults phases[PHASE_COUNT];
+  double intervals[PHASE_COUNT] = {0};  // Sum of the intervals of the devices at the end of each phase
+  int phase = PHASE_NORMAL;
+
+  while (!schedule.empty() && schedule.top().first < endMs) {
+    Event event = schedule.top();
+    schedule.pop();
+    Device& device = *devices[event.second];
+    g_millis = event.first;
+
+    // Degrade the server and network for the second phase
+    int eventPhase = g_millis / degradation.phaseMs;
+    if (eventPhase != phase) {
+      for (auto& each : devices) {
+        intervals[phase] += adaptive ? each->rate.interval() : intervalMs;
+      }
+      phase = eventPhase;
+      config = normal;
+      if (phase == PHASE_DEGRADED) {
+        config.latencyMs = degradation.latencyMs;
+        config.errorRate = degradation.errorRate;
+        for (double& serviceMs : config.serviceMs) {
+          serviceMs *= degradation.slowdown;
+        }
+      }
+    }
+
+    if (!device.provisioned) {
+      char token[64];
+      if (device.exosite.provision(device.identity, token, sizeof(token)).success) {
+        device.exosite.setToken(token);
+        device.provisioned = true;
+      }
+      schedule.push(Event(g_millis + (device.provisioned ? 0 : intervalMs), event.second));
+      continue;
+    }
+
+    unsigned long start = g_millis;
+    char value[32];
+    snprintf(value, sizeof(value), "{\"001\":%lu}", start % 1000);
+    ApiResponse res = device.exosite.write("data_in", value);
+
+    PeriodResults& period = periods[std::min(periods.size() - 1, (size_t)(start / periodMs))];
+    period.latencies.push_back(g_millis - start);
+    period.failures += !res.success;
+    phases[phase].latencies.push_back(g_millis - start);
+    phases[phase].failures += !res.success;
+
+    unsigned long waitMs = intervalMs;
+    if (adaptive) {
+      device.rate.update(res, device.exosite.lastRoundTrip());
+      waitMs = device.rate.interval();
+    }
+    schedule.push(Event(g_millis + waitMs, event.second));
+  }
+  for (auto& each : devices) {
+    intervals[phase] += adaptive ? each->rate.interval() : intervalMs;
+  }
+
+  // Recovery: first period after the degradation that is back to normal
+  unsigned long normalP90 = percentile(phases[PHASE_NORMAL].latencies, 0.9);
+  long recoveryMs = -1;
+  for (size_t i = 2 * degradation.phaseMs / periodMs; i < periods.size() && recoveryMs < 0; i++) {
+    const PeriodResults& period = periods[i];
+    if (!period.latencies.empty() && period.failures * 100 < period.latencies.size() &&
+        percentile(period.latencies, 0.9) <= 2 * normalP90) {
+      recoveryMs = i * periodMs - 2 * degradation.phaseMs;
+    }
+  }
+
+  for (int p = 0; p < PHASE_COUNT; p++) {
+    const PeriodResults& results = phases[p];
+    unsigned long writes = results.latencies.size();
+    printf("%-10s %-10s %8lu %7.2f%% %9.1f %8lu %8lu %8lu %12.1f\n", adaptive ? "controller" : "fixed", phaseNames[p],
+           writes, writes ? 100.0 * results.failures / writes : 0.0,
+           (double)(writes - results.failures) * 1000 / degradation.phaseMs,
+           percentile(results.latencies, 0.5), percentile(results.latencies, 0.9), percentile(results.latencies, 0.99),
+           intervals[p] / deviceCount / 1000);
+  }
+  if (recoveryMs >= 0) {
+    printf("%-10s recovered %lu s after the degradation ended; %lu refused, %.1f%% server load\n\n",
+           "", recoveryMs / 1000, server.errors, 100.0 * server.busyMs / (normal.workers * (double)endMs));
+  }
+  else {
+    printf("%-10s not recovered by the end of the run; %lu refused, %.1f%% server load\n\n",
+           "", server.errors, 100.0 * server.busyMs / (normal.workers * (double)endMs));
+  }
+}
+
+int main(int argc, char** argv) {
+  unsigned int devices = 2000;
+  unsigned long intervalMs = 10000;
+  Degradation degradation;
+  Controller controller;
+
+  for (int i = 1; i + 1 < argc; i += 2) {
+    unsigned long value = strtoul(argv[i + 1], nullptr, 10);
+    switch (argv[i][0] == '-' ? argv[i][1] : '\0') {
+      case 'd': devices = value > 0 ? value : 1; break;
+      case 'i': intervalMs = value > 0 ? value : 1; break;
+      case 't': degradation.phaseMs = (value > 0 ? value : 1) * 1000; break;
+      case 'l': degradation.latencyMs = value; break;
+      case 'e': degradation.errorRate = value / 100.0; break;
+      case 's': degradation.slowdown = value > 0 ? value : 1; break;
+      case 'm': controller.maxFactor = value > 0 ? value : 1; break;
+      case 'a': controller.stepMs = value; break;
+      default:
+        fprintf(stderr, "Unknown option: %s\n", argv[i]);
+        return 2;
+    }
+  }
+
+  ExositeLog::setOutput(nullptr); // Failures are counted rather than logged
+  g_millisStep = 0;                // Time only advances while waiting (see: `SimClient`)
+
+  LoadConfig normal;
+  printf("%u devices writing every %lu ms, %u workers; phases of %lu s: normal (%lu ms latency), "
+         "degraded (%lu ms latency, %.0f%% refused, %.0fx service times), recovered\n\n",
+         devices, intervalMs, normal.workers, degradation.phaseMs / 1000, normal.latencyMs, degradation.latencyMs,
+         100 * degradation.errorRate, degradation.slowdown);
+  printf("%-10s %-10s %8s %8s %9s %8s %8s %8s %12s\n",
+         "mode", "phase", "writes", "failed", "ok/s", "p50 ms", "p90 ms", "p99 ms", "interval s");
+  runFleet(devices, intervalMs, degradation, nullptr);
+  runFleet(devices, intervalMs, degradation, &controller);
+  return 0;
+}
@@ -0,0 +1,144 @@
+// Benchmark: sample ingest throughput and memory per channel of the sample buffer
+//
+// Usage: make -C test bench                                   (all benchmarks)
+//        test/build/bench_sample_buffer [options]
+//
+//   -r rate     Samples per second of each channel, for the upload comparison (default: 100)
+//   -s seconds  Duration (simulated) of the upload comparison (default: 60)
+//   -w window   Report window (ms) (default: 10000, the example's `report_rate`)
+//
+// Note:
+//
+// - Ingest times are those of the host, so only their scaling (per sample, per channel count)
+//   carries over to a device
+//
+// - Memory per channel is given for the host and for a 32-bit target (4 B pointers and longs),
+//   and compared with storing every sample of a window (as a `float`)
+//
+// - The upload comparison samples every channel at the given rate, either writing each set of
+//   samples (`writeChannels()`) or reporting the mean of each window (see: `report()`); requests
+//   block the loop on the simulated clock (incl. the ~100 ms `readHttpResponse()` waits for
+//   trailing data), so samples are taken late once it falls behind
+
+#include "ExositeSampleBuffer.h"
+#include "ExositeLog.h"
+#include "MockClient.h"
+#include "bench.h"
+
+#include <vector>
+
+// Bytes of per-channel state, given the size of pointers and longs
+static size_t channelBytes(size_t pointerSize, size_t longSize) {
+  return pointerSize + 2 * sizeof(uint8_t) + 3 * sizeof(float) + sizeof(double) + longSize;
+}
+
+// Uploads `seconds` of samples, returning the number of requests (and the bytes sent, and the
+// time taken, as requests block the sampling loop)
+static unsigned long upload(unsigned int channels, unsigned long rate, unsigned long seconds,
+                            unsigned long windowMs, bool aggregate, size_t& bytes, unsigned long& elapsedMs) {
+  static const char* const keys[] = {"001", "002", "003", "004", "005", "006", "007", "008"};
+  g_millis = 0; // Before the first window starts
+  MockClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  ExositeSampleBuffer samples(windowMs);
+  for (unsigned int i = 0; i < channels; i++) {
+    samples.addChannel(keys[i % 8]);
+  }
+
+  unsigned long requests = 0;
+  unsigned long ticks = seconds * rate;
+  for (unsigned long tick = 1; tick <= ticks; tick++) {
+    unsigned long sampleTime = tick * 1000 / rate;
+    if (g_millis < sampleTime) {
+      g_millis = sampleTime; // Otherwise late, after a request
+    }
+    if (aggregate) {
+      for (unsigned int i = 0; i < channels; i++) {
+        samples.addSample(i, 20.0f + (tick + i) % 50 * 0.1f);
+      }
+      if (samples.due()) {
+        client.respond("204 No Content");
+        requests += samples.report(exosite, "data_in").success;
+      }
+    }
+    else {
+      exosite.beginChannels();
+      for (unsigned int i = 0; i < channels; i++) {
+        exosite.addChannel(keys[i % 8], 20.0f + (tick + i) % 50 * 0.1f, 2);
+      }
+      client.respond("204 No Content");
+      requests += exosite.writeChannels("data_in").success;
+    }
+  }
+  bytes = client.out.size();
+  elapsedMs = g_millis;
+  return requests;
+}
+
+int main(int argc, char** argv) {
+  unsigned long rate = 100;
+  unsigned long seconds = 60;
+  unsigned long windowMs = 10000;
+
+  for (int i = 1; i + 1 < argc; i += 2) {
+    unsigned long value = strtoul(argv[i + 1], nullptr, 10);
+    switch (argv[i][0] == '-' ? argv[i][1] : '\0') {
+      case 'r': rate = value > 0 ? value : 1; break;
+      case 's': seconds = value > 0 ? value : 1; break;
+      case 'w': windowMs = value > 0 ? value : 1; break;
+      default:
+        fprintf(stderr, "Unknown option: %s\n", argv[i]);
+        return 2;
+    }
+  }
+
+  ExositeLog::setOutput(nullptr);
+  g_millisStep = 0; // Time only passes as set
+
+  // Ingest throughput, by number of channels sampled (round robin)
+  std::vector<float> values(1024);
+  for (size_t i = 0; i < values.size(); i++) {
+    values[i] = (float)((i * 7919) % 1000) / 10.0f;
+  }
+
+  printf("Sample ingest (host): %zu samples per batch, round robin over the channels\n\n", values.size());
+  printf("%8s %10s %12s\n", "channels", "ns/sample", "Msamples/s");
+  for (unsigned int channels = 1; channels <= EXO_SAMPLE_MAX_CHANNELS; channels *= 2) {
+    ExositeSampleBuffer samples;
+    for (unsigned int i = 0; i < channels; i++) {
+      samples.addChannel("001", AGGREGATE_MIN | AGGREGATE_MAX | AGGREGATE_MEAN | AGGREGATE_LAST | AGGREGATE_COUNT);
+    }
+    double us = timeUs([&] {
+      for (size_t i = 0; i < values.size(); i++) {
+        samples.addSample(i % channels, values[i]);
+      }
+    });
+    printf("%8u %10.2f %12.1f\n", channels, 1000.0 * us / values.size(), values.size() / us);
+  }
+
+  // Memory per channel, vs. storing the samples of a window
+  size_t hostChannel = channelBytes(sizeof(void*), sizeof(long));
+  size_t targetChannel = channelBytes(4, 4);
+  size_t rawChannel = rate * windowMs / 1000 * sizeof(float);
+  printf("\nMemory: sizeof(ExositeSampleBuffer) = %zu B on the host (EXO_SAMPLE_MAX_CHANNELS %d)\n\n",
+         sizeof(ExositeSampleBuffer), EXO_SAMPLE_MAX_CHANNELS);
+  printf("%-28s %10s %10s\n", "", "host B", "32-bit B");
+  printf("%-28s %10zu %10zu\n", "per channel", hostChannel, targetChannel);
+  printf("%-28s %10zu %10zu\n", "fixed (window, count)", sizeof(ExositeSampleBuffer) - EXO_SAMPLE_MAX_CHANNELS * hostChannel,
+         (size_t)(2 * 4 + sizeof(unsigned int)));
+  printf("%-28s %10zu %10zu  (%lu Hz x %lu ms)\n", "raw samples per channel", rawChannel, rawChannel, rate, windowMs);
+
+  // Uploads: every set of samples vs. one aggregate per window
+  printf("\nUploads: %lu s at %lu Hz per channel, %lu ms window\n\n", seconds, rate, windowMs);
+  printf("%8s %-10s %9s %11s %15s %10s\n", "channels", "mode", "requests", "bytes sent", "samples/request", "elapsed s");
+  for (unsigned int channels = 1; channels <= EXO_SAMPLE_MAX_CHANNELS; channels *= 2) {
+    for (bool aggregate : {false, true}) {
+      size_t bytes;
+      unsigned long elapsedMs;
+      unsigned long requests = upload(channels, rate, seconds, windowMs, aggregate, bytes, elapsedMs);
+      printf("%8u %-10s %9lu %11zu %15.1f %10.1f\n", channels, aggregate ? "aggregate" : "per sample", requests,
+             bytes, requests ? (double)seconds * rate * channels / requests : 0.0, elapsedMs / 1000.0);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,169 @@
+// Benchmark: producer-side enqueue latency of the network worker, vs. blocking writes
+//
+// Usage: make -C test bench                               (all benchmarks)
+//        test/build/bench_worker [options] [latency ...]  (network ms per request, default: 0 1 5)
+//
+//   -n writes   Writes submitted per run (default: 1000)
+//   -p period   Time between writes (us) of the producer (default: 2000)
+//
+// Note:
+//
+// - A network thread (`std::thread`) owns the `ExositeHTTP` instance and runs the submitted writes
+//   (see: `ExositeWorker`), against a client answering each request after a real (slept) delay
+//
+// - Enqueue latency is the (host) time of `submitWrite()` in the producer thread; writes rejected
+//   because the queue is full (i.e. the network falls behind the producer) are counted, not retried
+//
+// - The blocking baseline calls `write()` directly from the producer thread, as the example does
+
+#include "ExositeWorker.h"
+#include "ExositeLog.h"
+#include "MockClient.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+// Client answering each request (with a 204) after the given real delay
+struct LatentClient : public MockClient {
+  std::chrono::microseconds latency;
+
+  LatentClient(unsigned long latencyMs) : latency(latencyMs * 1000) {}
+
+  int available() override {
+    if (rx.empty() && out.size() != served && responses.empty()) {
+      std::this_thread::sleep_for(latency);
+      respond("204 No Content");
+    }
+    int count = MockClient::available();
+    if (served) {
+      out.clear(); // Only the request being written is kept
+      served = 0;
+    }
+    return count;
+  }
+};
+
+static double micros(Clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+// Prints the percentiles of the given latencies (us)
+static void printLatencies(const char* mode, unsigned long latencyMs, std::vector<double>& latencies,
+                           unsigned long rejected, double elapsedS) {
+  std::sort(latencies.begin(), latencies.end());
+  size_t n = latencies.size();
+  if (n == 0) {
+    printf("%10lu  %-8s %8s\n", latencyMs, mode, "-");
+    return;
+  }
+  printf("%10lu  %-8s %8zu %8lu %10.2f %10.2f %10.2f %9.1f\n", latencyMs, mode, n, rejected,
+         latencies[n / 2], latencies[n * 99 / 100], latencies[n - 1], elapsedS);
+}
+
+int main(int argc, char** argv) {
+  unsigned long writes = 1000;
+  unsigned long periodUs = 2000;
+  std::vector<unsigned long> networkLatencies;
+
+  for (int i = 1; i < argc; i++) {
+    if (argv[i][0] == '-' && i + 1 < argc) {
+      unsigned long value = strtoul(argv[++i], nullptr, 10);
+      switch (argv[i - 1][1]) {
+        case 'n': writes = value > 0 ? value : 1; break;
+        case 'p': periodUs = value; break;
+        default:
+          fprintf(stderr, "Unknown option: %s\n", argv[i - 1]);
+          return 2;
+      }
+    }
+    else {
+      networkLatencies.push_back(strtoul(argv[i], nullptr, 10));
+    }
+  }
+  if (networkLatencies.empty()) {
+    networkLatencies = {0, 1, 5};
+  }
+
+  ExositeLog::setOutput(nullptr);
+  g_millisStep = 0; // The (simulated) clock is only used by the network thread
+
+  printf("Enqueue latency (host us): %lu writes per run, one every %lu us, queue depth %d, %u CPU(s)\n\n",
+         writes, periodUs, EXO_WORKER_QUEUE_DEPTH, std::thread::hardware_concurrency());
+  printf("%10s  %-8s %8s %8s %10s %10s %10s %9s\n",
+         "network ms", "mode", "writes", "rejected", "p50 us", "p99 us", "max us", "elapsed s");
+
+  const char* payload = "{\"001\":1,\"002\":0,\"003\":1,\"004\":0,\"005\":2.41}";
+  for (unsigned long latencyMs : networkLatencies) {
+    // Through the worker: the producer only copies the write into a slot
+    {
+      LatentClient client(latencyMs);
+      ExositeHTTP exosite(&client, "example.com", "token");
+      ExositeWorker worker(exosite);
+
+      std::atomic<bool> done{false};
+      std::thread network([&] {
+        while (!done.load(std::memory_order_acquire) || worker.pending()) {
+          if (!worker.process()) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200)); // Idle (as `run()`)
+          }
+        }
+      });
+
+      std::vector<double> latencies;
+      latencies.reserve(writes);
+      unsigned long rejected = 0, completed = 0;
+      WorkerResult result;
+      Clock::time_point start = Clock::now();
+      for (unsigned long i = 0; i < writes; i++) {
+        std::this_thread::sleep_until(start + std::chrono::microseconds(periodUs * i));
+        Clock::time_point before = Clock::now();
+        bool queued = worker.submitWrite("data_in", payload, i);
+        Clock::time_point after = Clock::now();
+        if (queued) {
+          latencies.push_back(micros(after - before));
+        }
+        else {
+          rejected++;
+        }
+        while (worker.poll(result)) {
+          completed += result.response.success;
+        }
+      }
+      done.store(true, std::memory_order_release);
+      network.join();
+      while (worker.poll(result)) {
+        completed += result.response.success;
+      }
+      double elapsedS = micros(Clock::now() - start) / 1e6;
+      if (completed != latencies.size()) {
+        fprintf(stderr, "%lu of %zu writes failed\n", latencies.size() - completed, latencies.size());
+      }
+      printLatencies("worker", latencyMs, latencies, rejected, elapsedS);
+    }
+
+    // Blocking: the producer waits for each write
+    {
+      LatentClient client(latencyMs);
+      ExositeHTTP exosite(&client, "example.com", "token");
+
+      std::vector<double> latencies;
+      latencies.reserve(writes);
+      Clock::time_point start = Clock::now();
+      for (unsigned long i = 0; i < writes; i++) {
+        std::this_thread::sleep_until(start + std::chrono::microseconds(periodUs * i));
+        Clock::time_point before = Clock::now();
+        bool written = exosite.write("data_in", payload).success;
+        Clock::time_point after = Clock::now();
+        if (written) {
+          latencies.push_back(micros(after - before));
+        }
+      }
+      printLatencies("blocking", latencyMs, latencies, 0, micros(Clock::now() - start) / 1e6);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,102 @@
+// Compressed test vectors (see: test_deflate.cpp)
+#pragma once
+
+#include <stdint.h>
+
+// Generated with Python's zlib: the same document as zlib (dynamic Huffman), raw stored, and gzip
+static const uint8_t ZLIB_DYNAMIC[] = {
+  0x78, 0xda, 0xb5, 0xcd, 0x3f, 0x0b, 0xc2, 0x30, 0x10, 0x87, 0xe1, 0xaf, 0x22, 0x37, 0x3b, 0xa4,
+  0xff, 0x4b, 0x47, 0xc1, 0xa1, 0x83, 0x0e, 0x82, 0x73, 0x08, 0x69, 0xd4, 0x40, 0x4d, 0x42, 0x72,
+  0x0e, 0xa5, 0xe4, 0xbb, 0xdb, 0x76, 0xbf, 0xf1, 0x6e, 0xb9, 0xe5, 0xfd, 0xf1, 0xac, 0xa0, 0x3f,
+  0xca, 0x39, 0x33, 0x27, 0x18, 0x56, 0x10, 0xa2, 0xd8, 0xdf, 0x64, 0x53, 0x98, 0xd5, 0x22, 0x9d,
+  0xfa, 0x1a, 0x18, 0x60, 0x74, 0xe1, 0x87, 0xa7, 0x02, 0xce, 0x10, 0xa2, 0x0f, 0x26, 0xa2, 0x35,
+  0x47, 0x3d, 0x29, 0x54, 0x12, 0x97, 0xb0, 0x37, 0xf7, 0xe7, 0xed, 0x72, 0x7d, 0x1c, 0x89, 0xd1,
+  0x36, 0x59, 0xef, 0x60, 0x28, 0xf3, 0xb1, 0x40, 0xaf, 0xfd, 0x2c, 0xb5, 0x77, 0x2f, 0xfb, 0xde,
+  0x67, 0xd1, 0x04, 0x1f, 0x51, 0x46, 0x85, 0xdb, 0xb0, 0x10, 0xdb, 0xe5, 0x2d, 0x14, 0xa2, 0x24,
+  0xe9, 0x92, 0x9b, 0xae, 0x48, 0xba, 0xe2, 0xa6, 0x6b, 0x92, 0xae, 0xb9, 0xe9, 0x86, 0xa4, 0x1b,
+  0x6e, 0xba, 0x25, 0xe9, 0x96, 0x9b, 0xee, 0x48, 0xba, 0xe3, 0xa6, 0x7b, 0x92, 0xee, 0x39, 0xe9,
+  0x9c, 0xff, 0x63, 0x37, 0x4f, 0x16,
+};
+
+static const uint8_t RAW_STORED[] = {
+  0x01, 0xe6, 0x03, 0x19, 0xfc, 0x7b, 0x22, 0x63, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x73, 0x22,
+  0x3a, 0x7b, 0x22, 0x30, 0x30, 0x31, 0x22, 0x3a, 0x7b, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61,
+  0x79, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a, 0x22, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x31,
+  0x22, 0x2c, 0x22, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 0x3a, 0x7b,
+  0x22, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3a, 0x22, 0x4e, 0x55, 0x4d,
+  0x42, 0x45, 0x52, 0x22, 0x2c, 0x22, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x22,
+  0x3a, 0x32, 0x7d, 0x2c, 0x22, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x5f, 0x63, 0x6f,
+  0x6e, 0x66, 0x69, 0x67, 0x22, 0x3a, 0x7b, 0x22, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x72,
+  0x61, 0x74, 0x65, 0x22, 0x3a, 0x31, 0x30, 0x30, 0x30, 0x30, 0x7d, 0x7d, 0x2c, 0x22, 0x30, 0x30,
+  0x32, 0x22, 0x3a, 0x7b, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x5f, 0x6e, 0x61, 0x6d,
+  0x65, 0x22, 0x3a, 0x22, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x32, 0x22, 0x2c, 0x22, 0x70, 0x72,
+  0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 0x3a, 0x7b, 0x22, 0x64, 0x61, 0x74, 0x61,
+  0x5f, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3a, 0x22, 0x4e, 0x55, 0x4d, 0x42, 0x45, 0x52, 0x22, 0x2c,
+  0x22, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x3a, 0x32, 0x7d, 0x2c, 0x22,
+  0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x22,
+  0x3a, 0x7b, 0x22, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x72, 0x61, 0x74, 0x65, 0x22, 0x3a,
+  0x31, 0x30, 0x30, 0x30, 0x30, 0x7d, 0x7d, 0x2c, 0x22, 0x30, 0x30, 0x33, 0x22, 0x3a, 0x7b, 0x22,
+  0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a, 0x22, 0x49,
+  0x6e, 0x70, 0x75, 0x74, 0x20, 0x33, 0x22, 0x2c, 0x22, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74,
+  0x69, 0x65, 0x73, 0x22, 0x3a, 0x7b, 0x22, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x74, 0x79, 0x70, 0x65,
+  0x22, 0x3a, 0x22, 0x4e, 0x55, 0x4d, 0x42, 0x45, 0x52, 0x22, 0x2c, 0x22, 0x70, 0x72, 0x65, 0x63,
+  0x69, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x3a, 0x32, 0x7d, 0x2c, 0x22, 0x70, 0x72, 0x6f, 0x74, 0x6f,
+  0x63, 0x6f, 0x6c, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x22, 0x3a, 0x7b, 0x22, 0x72, 0x65,
+  0x70, 0x6f, 0x72, 0x74, 0x5f, 0x72, 0x61, 0x74, 0x65, 0x22, 0x3a, 0x31, 0x30, 0x30, 0x30, 0x30,
+  0x7d, 0x7d, 0x2c, 0x22, 0x30, 0x30, 0x34, 0x22, 0x3a, 0x7b, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6c,
+  0x61, 0x79, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a, 0x22, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x20,
+  0x34, 0x22, 0x2c, 0x22, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 0x3a,
+  0x7b, 0x22, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3a, 0x22, 0x4e, 0x55,
+  0x4d, 0x42, 0x45, 0x52, 0x22, 0x2c, 0x22, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e,
+  0x22, 0x3a, 0x32, 0x7d, 0x2c, 0x22, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x5f, 0x63,
+  0x6f, 0x6e, 0x66, 0x69, 0x67, 0x22, 0x3a, 0x7b, 0x22, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x5f,
+  0x72, 0x61, 0x74, 0x65, 0x22, 0x3a, 0x31, 0x30, 0x30, 0x30, 0x30, 0x7d, 0x7d, 0x2c, 0x22, 0x30,
+  0x30, 0x35, 0x22, 0x3a, 0x7b, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x5f, 0x6e, 0x61,
+  0x6d, 0x65, 0x22, 0x3a, 0x22, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x35, 0x22, 0x2c, 0x22, 0x70,
+  0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 0x3a, 0x7b, 0x22, 0x64, 0x61, 0x74,
+  0x61, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3a, 0x22, 0x4e, 0x55, 0x4d, 0x42, 0x45, 0x52, 0x22,
+  0x2c, 0x22, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x3a, 0x32, 0x7d, 0x2c,
+  0x22, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67,
+  0x22, 0x3a, 0x7b, 0x22, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x72, 0x61, 0x74, 0x65, 0x22,
+  0x3a, 0x31, 0x30, 0x30, 0x30, 0x30, 0x7d, 0x7d, 0x2c, 0x22, 0x30, 0x30, 0x36, 0x22, 0x3a, 0x7b,
+  0x22, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a, 0x22,
+  0x49, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x36, 0x22, 0x2c, 0x22, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72,
+  0x74, 0x69, 0x65, 0x73, 0x22, 0x3a, 0x7b, 0x22, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x74, 0x79, 0x70,
+  0x65, 0x22, 0x3a, 0x22, 0x4e, 0x55, 0x4d, 0x42, 0x45, 0x52, 0x22, 0x2c, 0x22, 0x70, 0x72, 0x65,
+  0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x3a, 0x32, 0x7d, 0x2c, 0x22, 0x70, 0x72, 0x6f, 0x74,
+  0x6f, 0x63, 0x6f, 0x6c, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x22, 0x3a, 0x7b, 0x22, 0x72,
+  0x65, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x72, 0x61, 0x74, 0x65, 0x22, 0x3a, 0x31, 0x30, 0x30, 0x30,
+  0x30, 0x7d, 0x7d, 0x2c, 0x22, 0x30, 0x30, 0x37, 0x22, 0x3a, 0x7b, 0x22, 0x64, 0x69, 0x73, 0x70,
+  0x6c, 0x61, 0x79, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a, 0x22, 0x49, 0x6e, 0x70, 0x75, 0x74,
+  0x20, 0x37, 0x22, 0x2c, 0x22, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22,
+  0x3a, 0x7b, 0x22, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3a, 0x22, 0x4e,
+  0x55, 0x4d, 0x42, 0x45, 0x52, 0x22, 0x2c, 0x22, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f,
+  0x6e, 0x22, 0x3a, 0x32, 0x7d, 0x2c, 0x22, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x5f,
+  0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x22, 0x3a, 0x7b, 0x22, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74,
+  0x5f, 0x72, 0x61, 0x74, 0x65, 0x22, 0x3a, 0x31, 0x30, 0x30, 0x30, 0x30, 0x7d, 0x7d, 0x2c, 0x22,
+  0x30, 0x30, 0x38, 0x22, 0x3a, 0x7b, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x5f, 0x6e,
+  0x61, 0x6d, 0x65, 0x22, 0x3a, 0x22, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x38, 0x22, 0x2c, 0x22,
+  0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 0x3a, 0x7b, 0x22, 0x64, 0x61,
+  0x74, 0x61, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3a, 0x22, 0x4e, 0x55, 0x4d, 0x42, 0x45, 0x52,
+  0x22, 0x2c, 0x22, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x3a, 0x32, 0x7d,
+  0x2c, 0x22, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x5f, 0x63, 0x6f, 0x6e, 0x66, 0x69,
+  0x67, 0x22, 0x3a, 0x7b, 0x22, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x72, 0x61, 0x74, 0x65,
+  0x22, 0x3a, 0x31, 0x30, 0x30, 0x30, 0x30, 0x7d, 0x7d, 0x7d, 0x7d,
+};
+
+static const uint8_t GZIP_DYNAMIC[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0xcd, 0x3f, 0x0b, 0xc2, 0x30,
+  0x10, 0x87, 0xe1, 0xaf, 0x22, 0x37, 0x3b, 0xa4, 0xff, 0x4b, 0x47, 0xc1, 0xa1, 0x83, 0x0e, 0x82,
+  0x73, 0x08, 0x69, 0xd4, 0x40, 0x4d, 0x42, 0x72, 0x0e, 0xa5, 0xe4, 0xbb, 0xdb, 0x76, 0xbf, 0xf1,
+  0x6e, 0xb9, 0xe5, 0xfd, 0xf1, 0xac, 0xa0, 0x3f, 0xca, 0x39, 0x33, 0x27, 0x18, 0x56, 0x10, 0xa2,
+  0xd8, 0xdf, 0x64, 0x53, 0x98, 0xd5, 0x22, 0x9d, 0xfa, 0x1a, 0x18, 0x60, 0x74, 0xe1, 0x87, 0xa7,
+  0x02, 0xce, 0x10, 0xa2, 0x0f, 0x26, 0xa2, 0x35, 0x47, 0x3d, 0x29, 0x54, 0x12, 0x97, 0xb0, 0x37,
+  0xf7, 0xe7, 0xed, 0x72, 0x7d, 0x1c, 0x89, 0xd1, 0x36, 0x59, 0xef, 0x60, 0x28, 0xf3, 0xb1, 0x40,
+  0xaf, 0xfd, 0x2c, 0xb5, 0x77, 0x2f, 0xfb, 0xde, 0x67, 0xd1, 0x04, 0x1f, 0x51, 0x46, 0x85, 0xdb,
+  0xb0, 0x10, 0xdb, 0xe5, 0x2d, 0x14, 0xa2, 0x24, 0xe9, 0x92, 0x9b, 0xae, 0x48, 0xba, 0xe2, 0xa6,
+  0x6b, 0x92, 0xae, 0xb9, 0xe9, 0x86, 0xa4, 0x1b, 0x6e, 0xba, 0x25, 0xe9, 0x96, 0x9b, 0xee, 0x48,
+  0xba, 0xe3, 0xa6, 0x7b, 0x92, 0xee, 0x39, 0xe9, 0x9c, 0xff, 0x76, 0x94, 0x01, 0xd1, 0xe6, 0x03,
+  0x00, 0x00,
+};
+
+static const char VECTOR_TEXT[] = "{\"channels\":{\"001\":{\"display_name\":\"Input 1\",\"properties\":{\"data_type\":\"NUMBER\",\"precision\":2},\"protocol_config\":{\"report_rate\":10000}},\"002\":{\"display_name\":\"Input 2\",\"properties\":{\"data_type\":\"NUMBER\",\"precision\":2},\"protocol_config\":{\"report_rate\":10000}},\"003\":{\"display_name\":\"Input 3\",\"properties\":{\"data_type\":\"NUMBER\",\"precision\":2},\"protocol_config\":{\"report_rate\":10000}},\"004\":{\"display_name\":\"Input 4\",\"properties\":{\"data_type\":\"NUMBER\",\"precision\":2},\"protocol_config\":{\"report_rate\":10000}},\"005\":{\"display_name\":\"Input 5\",\"properties\":{\"data_type\":\"NUMBER\",\"precision\":2},\"protocol_config\":{\"report_rate\":10000}},\"006\":{\"display_name\":\"Input 6\",\"properties\":{\"data_type\":\"NUMBER\",\"precision\":2},\"protocol_config\":{\"report_rate\":10000}},\"007\":{\"display_name\":\"Input 7\",\"properties\":{\"data_type\":\"NUMBER\",\"precision\":2},\"protocol_config\":{\"report_rate\":10000}},\"008\":{\"display_name\":\"Input 8\",\"properties\":{\"data_type\":\"NUMBER\",\"precision\":2},\"protocol_config\":{\"report_rate\":10000}}}}";
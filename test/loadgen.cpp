@@ -0,0 +1,196 @@
+// Fleet load generator: many `ExositeHTTP` instances reporting to a stand-in Exosite server
+//
+// Usage: make -C test loadgen                        (default concurrency levels)
+//        test/build/loadgen [options] [devices ...]  (default: 100 1000 10000)
+//
+//   -t seconds  Simulated duration of each run (default: 300)
+//   -i ms       Mean interval between the calls of a device (default: 15000)
+//   -w workers  Server workers (default: 2)
+//   -l ms       One-way network latency (default: 20)
+//   -k ms       Server keep-alive idle timeout (default: 20000)
+//
+// Note:
+//
+// - Each device is a real `ExositeHTTP` instance, with its own identity (provisioned for a token)
+//   and its own `SimClient`; devices run on the virtual clock of the host stubs, each call
+//   starting when the clock reaches its scheduled time (in time order), so one process drives
+//   thousands of devices without sockets or threads
+//
+// - The server and connections are simulated by `StandInServer` and `SimClient` (see:
+//   `SimServer.h`); workers are assigned in the order calls start, so a request may wait behind
+//   one that arrives slightly later (by at most a connection setup)
+//
+// - Latency, failures, and connections are measured around each call, outside the library
+
+#include "ExositeHTTP.h"
+#include "ExositeLog.h"
+#include "SimServer.h"
+
+#include <memory>
+
+struct Device {
+  SimClient client;
+  ExositeHTTP exosite;
+  char identity[16];
+  bool provisioned = false;
+  unsigned long calls = 0;
+
+  Device(StandInServer& server, const LoadConfig& config, unsigned int index)
+      : client(server, config), exosite(&client, "loadgen.m2.exosite.io") {
+    snprintf(identity, sizeof(identity), "lg-%06u", index);
+  }
+};
+
+struct ApiResults {
+  std::vector<unsigned long> latencies;
+  unsigned long failures = 0;
+  unsigned long connects = 0;
+};
+
+// Runs the next call of a device, returning its result
+static bool runCall(Device& device, LoadApi api, const LoadConfig& config, ApiResults& results) {
+  unsigned long start = g_millis;
+  unsigned long connects = device.client.connects;
+  char value[64];
+  ApiResponse res;
+
+  switch (api) {
+    case LOAD_PROVISION:
+      res = device.exosite.provision(device.identity, value, sizeof(value));
+      if (res.success) {
+        device.exosite.setToken(value);
+        device.provisioned = true;
+      }
+      break;
+    case LOAD_TIMESTAMP: {
+      unsigned long serverTime;
+      res = device.exosite.timestamp(&serverTime);
+      break;
+    }
+    case LOAD_WRITE:
+      snprintf(value, sizeof(value), "{\"001\":%lu,\"002\":%lu}", device.calls, start % 100);
+      res = device.exosite.write("data_in", value);
+      break;
+    case LOAD_READ:
+      res = device.exosite.read("data_out", value, sizeof(value));
+      break;
+    default:
+      res = device.exosite.longPoll("data_out", value, sizeof(value), 0, config.pollTimeoutMs);
+      break;
+  }
+
+  results.latencies.push_back(g_millis - start);
+  results.failures += !res.success;
+  results.connects += device.client.connects - connects;
+  device.calls++;
+  return res.success;
+}
+
+static unsigned long percentile(const std::vector<unsigned long>& sorted, double p) {
+  return sorted.empty() ? 0 : sorted[std::min(sorted.size() - 1, (size_t)(p * sorted.size()))];
+}
+
+static void runLoad(const LoadConfig& config, unsigned int deviceCount) {
+  g_millis = 0;
+  StandInServer server(config);
+  std::mt19937 rng(deviceCount);
+  std::uniform_real_distribution<double> uniform(0, 1);
+
+  std::vector<std::unique_ptr<Device>> devices;
+  typedef std::pair<unsigned long, unsigned int> Event; // Next call (ms), device
+  std::priority_queue<Event, std::vector<Event>, std::greater<Event>> schedule;
+  for (unsigned int i = 0; i < deviceCount; i++) {
+    devices.emplace_back(new Device(server, config, i));
+    schedule.push(Event((unsigned long)(uniform(rng) * config.intervalMs), i));
+  }
+
+  ApiResults results[LOAD_API_COUNT];
+  const unsigned long endMs = config.seconds * 1000;
+  while (!schedule.empty() && schedule.top().first < endMs) {
+    Event event = schedule.top();
+    schedule.pop();
+    Device& device = *devices[event.second];
+    g_millis = event.first;
+
+    // Provision (then check the clock) once, then report with a mix of calls
+    LoadApi api;
+    if (!device.provisioned) {
+      api = LOAD_PROVISION;
+    }
+    else if (device.calls == 1) {
+      api = LOAD_TIMESTAMP;
+    }
+    else {
+      double mix = uniform(rng);
+      api = mix < 0.7 ? LOAD_WRITE : mix < 0.9 ? LOAD_READ : LOAD_LONG_POLL;
+    }
+
+    bool success = runCall(device, api, config, results[api]);
+    unsigned long next = g_millis;
+    if (api != LOAD_PROVISION || !success) {
+      next += (unsigned long)((0.5 + uniform(rng)) * config.intervalMs);
+    }
+    schedule.push(Event(next, event.second));
+  }
+
+  unsigned long serverCloses = 0;
+  for (auto& device : devices) {
+    serverCloses += device->client.serverCloses;
+  }
+
+  for (int api = 0; api < LOAD_API_COUNT; api++) {
+    std::vector<unsigned long>& latencies = results[api].latencies;
+    if (latencies.empty()) {
+      continue;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    unsigned long calls = latencies.size();
+    printf("%8u  %-10s %8lu %7.2f%% %9.1f %8lu %8lu %8lu %8lu %9.1f\n",
+           deviceCount, apiNames[api], calls, 100.0 * results[api].failures / calls,
+           (double)(calls - results[api].failures) / config.seconds,
+           percentile(latencies, 0.5), percentile(latencies, 0.9), percentile(latencies, 0.99),
+           latencies.back(), 100.0 * results[api].connects / calls);
+  }
+  printf("%8s  server: %lu requests, %.1f%% offered load, queue wait %.1f ms mean / %lu ms max, %lu idle closes\n\n",
+         "", server.requests, 100.0 * server.busyMs / (config.workers * (double)endMs),
+         server.requests ? server.waitMs / server.requests : 0.0, server.maxWaitMs, serverCloses);
+}
+
+int main(int argc, char** argv) {
+  LoadConfig config;
+  std::vector<unsigned int> levels;
+
+  for (int i = 1; i < argc; i++) {
+    if (argv[i][0] == '-' && i + 1 < argc) {
+      unsigned long value = strtoul(argv[++i], nullptr, 10);
+      switch (argv[i - 1][1]) {
+        case 't': config.seconds = value; break;
+        case 'i': config.intervalMs = value; break;
+        case 'w': config.workers = value > 0 ? value : 1; break;
+        case 'l': config.latencyMs = value; break;
+        case 'k': config.keepAliveMs = value; break;
+        default:
+          fprintf(stderr, "Unknown option: %s\n", argv[i - 1]);
+          return 2;
+      }
+    }
+    else {
+      levels.push_back(strtoul(argv[i], nullptr, 10));
+    }
+  }
+  if (levels.empty()) {
+    levels = {100, 1000, 10000};
+  }
+
+  ExositeLog::setOutput(nullptr); // Failures are counted rather than logged
+  g_millisStep = 0;                // Time only advances while waiting (see: `SimClient`)
+
+  printf("%lu s per run, calls every %lu ms per device, %u workers, %lu ms latency, %lu ms keep-alive\n\n",
+         config.seconds, config.intervalMs, config.workers, config.latencyMs, config.keepAliveMs);
+  printf("%8s  %-10s %8s %8s %9s %8s %8s %8s %8s %9s\n",
+         "devices", "api", "calls", "failed", "ok/s", "p50 ms", "p90 ms", "p99 ms", "max ms", "conn/100");
+  for (unsigned int devices : levels) {
+    runLoad(config, devices);
+  }
+  return 0;
+}
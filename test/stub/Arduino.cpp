@@ -0,0 +1,19 @@
+#include "Arduino.h"
+
+unsigned long g_millis = 0;
+unsigned long g_millisStep = 1;
+
+unsigned long millis() {
+  unsigned long now = g_millis;
+  g_millis += g_millisStep;
+  return now;
+}
+
+void delay(unsigned long ms) {
+  g_millis += ms;
+}
+
+void yield() {
+}
+
+HardwareSerial Serial;
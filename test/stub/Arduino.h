@@ -0,0 +1,115 @@
+// Minimal host stand-in for the Arduino core, covering what the library uses
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string>
+
+#define ARDUINO 10800
+#define HEX 16
+#define DEC 10
+
+// Simulated clock: `millis()` advances by `g_millisStep` (default: 1 ms) per call, `delay()` by
+// the requested time
+extern unsigned long g_millis;
+extern unsigned long g_millisStep;
+
+unsigned long millis();
+void delay(unsigned long ms);
+void yield();
+
+class __FlashStringHelper;
+#define F(x) (reinterpret_cast<const __FlashStringHelper*>(x))
+
+class String {
+  public:
+    String() {}
+    String(const char* c) : s(c ? c : "") {}
+    String(const String& o) = default;
+    String(int v) : s(std::to_string(v)) {}
+    String& operator=(const String& o) = default;
+
+    unsigned int length() const { return s.size(); }
+    const char* c_str() const { return s.c_str(); }
+    char charAt(unsigned int i) const { return s[i]; }
+    bool reserve(unsigned int n) { s.reserve(n); return true; }
+    bool isEmpty() const { return s.empty(); }
+    String& operator+=(char c) { s += c; return *this; }
+    String& operator+=(const char* c) { s += c; return *this; }
+    bool operator==(const char* c) const { return s == c; }
+
+  private:
+    std::string s;
+};
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buf, size_t size) {
+      size_t i = 0;
+      for (; i < size; i++) write(buf[i]);
+      return i;
+    }
+    virtual void flush() {}
+    int availableForWrite() { return 64; }
+
+    size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+    size_t print(const __FlashStringHelper* s) { return print((const char*)s); }
+    size_t print(const String& s) { return print(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v, int base=DEC) { return printNumber(base == HEX ? "%x" : "%d", v); }
+    size_t print(unsigned int v, int base=DEC) { return printNumber(base == HEX ? "%x" : "%u", v); }
+    size_t print(long v, int=DEC) { return printNumber("%ld", v); }
+    size_t print(unsigned long v, int=DEC) { return printNumber("%lu", v); }
+    size_t print(double v, int digits=2) { char t[48]; snprintf(t, sizeof(t), "%.*f", digits, v); return print(t); }
+
+    template<typename T> size_t println(const T& v) { size_t n = print(v); return n + println(); }
+    size_t println() { return print("\r\n"); }
+
+  private:
+    template<typename T> size_t printNumber(const char* format, T v) {
+      char t[24];
+      snprintf(t, sizeof(t), format, v);
+      return print(t);
+    }
+};
+
+class Stream : public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    void setTimeout(unsigned long timeout) { _timeout = timeout; }
+    unsigned long getTimeout() { return _timeout; }
+
+  protected:
+    unsigned long _timeout = 1000;
+};
+
+class IPAddress {
+  public:
+    IPAddress() {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) { _b[0] = a; _b[1] = b; _b[2] = c; _b[3] = d; }
+    uint8_t operator[](int i) const { return _b[i]; }
+    bool operator==(const IPAddress& o) const { return memcmp(_b, o._b, 4) == 0; }
+    bool operator!=(const IPAddress& o) const { return !(*this == o); }
+
+  private:
+    uint8_t _b[4] = {0, 0, 0, 0};
+};
+
+class HardwareSerial : public Stream {
+  public:
+    size_t write(uint8_t c) override { return fputc(c, stderr) == EOF ? 0 : 1; }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    operator bool() { return true; }
+};
+
+extern HardwareSerial Serial;
@@ -0,0 +1,39 @@
+// Minimal assertions for host tests (each test is a program; the exit status reports failures)
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+
+static int testFailures = 0;
+
+#define CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+      testFailures++; \
+    } \
+  } while (0)
+
+#define CHECK_EQ(actual, expected) \
+  do { \
+    long long a_ = (long long)(actual), e_ = (long long)(expected); \
+    if (a_ != e_) { \
+      fprintf(stderr, "%s:%d: %s == %lld, expected %lld\n", __FILE__, __LINE__, #actual, a_, e_); \
+      testFailures++; \
+    } \
+  } while (0)
+
+#define CHECK_STR(actual, expected) \
+  do { \
+    const char* a_ = (actual); \
+    const char* e_ = (expected); \
+    if (strcmp(a_, e_) != 0) { \
+      fprintf(stderr, "%s:%d: %s == \"%s\", expected \"%s\"\n", __FILE__, __LINE__, #actual, a_, e_); \
+      testFailures++; \
+    } \
+  } while (0)
+
+static int testResult(const char* name) {
+  printf("%s: %s\n", name, testFailures ? "FAILED" : "passed");
+  return testFailures ? 1 : 0;
+}
@@ -0,0 +1,65 @@
+// Per-call time budget (see: `setRequestBudget()`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "test.h"
+
+// Client whose connection (incl. handshake) takes a fixed time
+struct SlowClient : public MockClient {
+  unsigned long connectMs = 0;
+  unsigned long timeoutDuringConnect = 0;
+
+  int connect(const char* host, uint16_t port) override {
+    timeoutDuringConnect = getTimeout();
+    delay(connectMs);
+    return MockClient::connect(host, port);
+  }
+};
+
+int main() {
+  SlowClient client;
+  client.setTimeout(5000);
+  ExositeHTTP exosite(&client, "example.com", "token");
+  exosite.setRequestBudget(1000);
+
+  // Within budget: the client timeout is bounded during connect only
+  client.connectMs = 200;
+  client.respond("204 No Content");
+  CHECK(exosite.write("data_in", "1").success);
+  CHECK(client.timeoutDuringConnect <= 1000);
+  CHECK_EQ(client.getTimeout(), 5000);
+
+  // Budget exhausted by the connection: nothing is sent, and the connection is closed
+  client.open = false;
+  client.connectMs = 1500;
+  client.out.clear();
+  int stops = client.stops;
+  ApiResponse res = exosite.write("data_in", "2");
+  CHECK(!res.success);
+  CHECK(client.out.empty());
+  CHECK(!client.open);
+  CHECK(client.stops > stops);
+  CHECK_EQ(client.getTimeout(), 5000);
+
+  // Budget exhausted while sending the headers: the body is not sent
+  struct SlowWriter : public SlowClient {
+    size_t write(const uint8_t* buf, size_t size) override { delay(size); return MockClient::write(buf, size); }
+    size_t write(uint8_t c) override { delay(1); return MockClient::write(c); }
+  } writer;
+  ExositeHTTP slow(&writer, "example.com", "token");
+  slow.setRequestBudget(100);
+  std::string value(50, 'x');
+  CHECK(!slow.write("data_in", value.c_str()).success);
+  CHECK(writer.out.find("Content-Length") != std::string::npos);
+  CHECK(writer.out.find("data_in=") == std::string::npos);
+  CHECK(!writer.open);
+
+  // Reads are bounded too
+  client.open = false;
+  client.connectMs = 0;
+  client.respond("200 OK", "data_out=1");
+  char value2[16];
+  CHECK(exosite.read("data_out", value2, sizeof(value2)).success);
+  CHECK_STR(value2, "1");
+
+  return testResult("budget");
+}
@@ -0,0 +1,98 @@
+// Buffer usage instrumentation (see: `getBufferStats()`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "test.h"
+
+static MockClient client;
+static ExositeHTTP exosite(&client, "example.com", "token");
+
+// Length of the response headers (incl. the blank line) with the given status and body length
+static size_t headerLength(const char* status, size_t bodyLen) {
+  return std::string("HTTP/1.1 " + std::string(status) + "\r\nContent-Length: " + std::to_string(bodyLen) + "\r\n\r\n").size();
+}
+
+int main() {
+  BufferStats stats = exosite.getBufferStats();
+  CHECK_EQ(stats.encodedHighWater + stats.headerHighWater + stats.bodyHighWater + stats.decodedHighWater, 0);
+  CHECK_EQ(stats.nearMisses + stats.overflows, 0);
+
+  // High-water marks of each buffer
+  char value[16];
+  client.respond("200 OK", "data_out=a%20b");
+  CHECK(exosite.read("data_out", value, sizeof(value)).success);
+  client.respond("204 No Content");
+  CHECK(exosite.write("data_in", "{\"001\":1}").success);
+  stats = exosite.getBufferStats();
+  CHECK_EQ(stats.headerHighWater, headerLength("204 No Content", 0)); // Longer than those of the read
+  CHECK_EQ(stats.bodyHighWater, 14);
+  CHECK_EQ(stats.decodedHighWater, 3);
+  CHECK_EQ(stats.encodedHighWater, strlen("%7B%22001%22%3A1%7D"));
+  CHECK_EQ(stats.nearMisses, 0);
+
+  // ...which only grow
+  client.respond("200 OK", "data_out=x");
+  CHECK(exosite.read("data_out", value, sizeof(value)).success);
+  CHECK_EQ(exosite.getBufferStats().bodyHighWater, 14);
+  CHECK_EQ(exosite.getBufferStats().decodedHighWater, 3);
+
+  // Using >= 90% of a buffer is a near miss: 14 of 15 characters
+  client.respond("200 OK", "data_out=" + std::string(14, 'v'));
+  CHECK(exosite.read("data_out", value, sizeof(value)).success);
+  stats = exosite.getBufferStats();
+  CHECK_EQ(stats.decodedHighWater, 14);
+  CHECK_EQ(stats.nearMisses, 1);
+  CHECK_EQ(stats.overflows, 0);
+
+  // A value larger than the provided buffer overflows
+  client.respond("200 OK", "data_out=" + std::string(16, 'v'));
+  CHECK(!exosite.read("data_out", value, sizeof(value)).success);
+  stats = exosite.getBufferStats();
+  CHECK_EQ(stats.overflows, 1);
+  CHECK_EQ(stats.decodedHighWater, 14);
+
+  // A response body close to filling the internal buffer is a near miss
+  size_t nearBody = (EXO_DATA_BUFFER_SIZE - 1 - headerLength("200 OK", 999)) * 95 / 100;
+  char large[EXO_DATA_BUFFER_SIZE];
+  client.respond("200 OK", "data_out=" + std::string(nearBody - 9, 'v'));
+  CHECK(exosite.read("data_out", large, sizeof(large)).success);
+  stats = exosite.getBufferStats();
+  CHECK_EQ(stats.bodyHighWater, nearBody);
+  CHECK_EQ(stats.nearMisses, 3); // The body, and its value decoded into `large`
+
+  // An oversized response overflows the internal buffer (and is flushed, so the next one reads)
+  client.respond("200 OK", "data_out=" + std::string(EXO_DATA_BUFFER_SIZE * 2, 'v'));
+  CHECK(!exosite.read("data_out", large, sizeof(large)).success);
+  stats = exosite.getBufferStats();
+  CHECK_EQ(stats.overflows, 2);
+  CHECK_EQ(stats.bodyHighWater, nearBody);
+
+  client.respond("200 OK", "data_out=ok");
+  CHECK(exosite.read("data_out", value, sizeof(value)).success);
+  CHECK_STR(value, "ok");
+
+  // A value too large to encode overflows, without a request
+  size_t written = client.out.size();
+  CHECK(!exosite.write("data_in", std::string(EXO_DATA_BUFFER_SIZE / 3 + 1, '"').c_str()).success);
+  CHECK_EQ(client.out.size(), written);
+  stats = exosite.getBufferStats();
+  CHECK_EQ(stats.overflows, 3);
+  CHECK_EQ(stats.encodedHighWater, strlen("%7B%22001%22%3A1%7D"));
+
+  // ...as does a channel payload
+  exosite.beginChannels();
+  bool added = true;
+  for (int i = 0; i < 1000 && added; i++) {
+    added = exosite.addChannel("001", i);
+  }
+  CHECK(!added);
+  CHECK(!exosite.writeChannels("data_in").success);
+  CHECK_EQ(exosite.getBufferStats().overflows, 4);
+
+  // Counters are cleared on reset
+  exosite.resetBufferStats();
+  stats = exosite.getBufferStats();
+  CHECK_EQ(stats.encodedHighWater + stats.headerHighWater + stats.bodyHighWater + stats.decodedHighWater, 0);
+  CHECK_EQ(stats.nearMisses + stats.overflows, 0);
+
+  return testResult("buffer_stats");
+}
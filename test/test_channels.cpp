@@ -0,0 +1,47 @@
+// Channel payload writer (see: `beginChannels()`, `addChannel()`, `writeChannels()`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "test.h"
+
+static std::string requestBody(MockClient& client) {
+  std::string request = client.lastRequest();
+  size_t body = request.find("\r\n\r\n");
+  return body == std::string::npos ? std::string() : request.substr(body + 4);
+}
+
+int main() {
+  MockClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+
+  // Values are encoded straight into the request body
+  exosite.beginChannels();
+  CHECK(exosite.addChannel("001", 1));
+  CHECK(exosite.addChannel("002", true));
+  CHECK(exosite.addChannel("003", -42L));
+  CHECK(exosite.addChannel("005", 2.4149, 2));
+  client.respond("204 No Content");
+  ApiResponse res = exosite.writeChannels("data_in");
+  CHECK(res.success);
+  CHECK_EQ(res.statusCode, 204);
+  std::string body = requestBody(client);
+  CHECK_STR(body.c_str(),
+            "data_in=%7B%22001%22%3A1%2C%22002%22%3Atrue%2C%22003%22%3A-42%2C%22005%22%3A2.41%7D\r\n");
+
+  // An empty payload is still a valid object
+  exosite.beginChannels();
+  client.respond("204 No Content");
+  CHECK(exosite.writeChannels("data_in").success);
+  body = requestBody(client);
+  CHECK_STR(body.c_str(), "data_in=%7B%7D\r\n");
+
+  // A payload larger than the internal buffer is rejected (rather than truncated)
+  exosite.beginChannels();
+  bool added = true;
+  for (int i = 0; i < 1000 && added; i++) {
+    added = exosite.addChannel("channel", i);
+  }
+  CHECK(!added);
+  CHECK(!exosite.writeChannels("data_in").success);
+
+  return testResult("channels");
+}
@@ -0,0 +1,127 @@
+// Server clock tracking (see: `now()`, `setClockTolerance()`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "test.h"
+
+// Client answering each request after a round trip of `latencyMs`
+struct LatentClient : public MockClient {
+  unsigned long latencyMs = 0;
+
+  int available() override {
+    if (rx.empty() && out.size() != served && !responses.empty()) {
+      delay(latencyMs);
+    }
+    return MockClient::available();
+  }
+};
+
+static const unsigned long unsynced = 1; // `timestamp()` value, when `now()` could not estimate
+
+// Samples the `Date` header of a write response, and returns the estimate of `now()`
+static unsigned long sampleDate(const char* date) {
+  MockClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  client.respond("204 No Content", "", (std::string("Date: ") + date + "\r\n").c_str());
+  exosite.write("data_in", "1");
+
+  client.respond("200 OK", "1");
+  unsigned long serverTime = 0;
+  exosite.now(&serverTime);
+  return serverTime;
+}
+
+int main() {
+  g_millisStep = 0; // Time only passes by `delay()`
+
+  // `Date` headers (RFC 7231 IMF-fixdate) are sampled, malformed ones are ignored
+  CHECK_EQ(sampleDate("Thu, 01 Jan 1970 00:00:00 GMT"), 0);
+  CHECK_EQ(sampleDate("Tue, 14 Nov 2023 22:13:20 GMT"), 1700000000);
+  CHECK_EQ(sampleDate("Thu, 29 Feb 2024 23:59:59 GMT"), 1709251199);
+  CHECK_EQ(sampleDate("Sun, 18 Oct 2026 12:00:00 GMT"), 1792324800);
+  CHECK_EQ(sampleDate("Sun, 18 Okt 2026 12:00:00 GMT"), unsynced);
+  CHECK_EQ(sampleDate("Sun, 18 October 2026 12:00:00 GMT"), unsynced);
+  CHECK_EQ(sampleDate("Wed, 31 Dec 1969 23:59:59 GMT"), unsynced);
+  CHECK_EQ(sampleDate("1700000000"), unsynced);
+  CHECK_EQ(sampleDate(""), unsynced);
+
+  LatentClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  unsigned long serverTime = 0;
+
+  // Without a sample, `now()` requests the time
+  client.respond("200 OK", "1700000000");
+  ApiResponse res = exosite.now(&serverTime);
+  CHECK(res.success);
+  CHECK_EQ(res.statusCode, 200);
+  CHECK_EQ(serverTime, 1700000000);
+  CHECK_EQ(client.count("GET /timestamp"), 1);
+
+  // ...then estimates it locally (from the midpoint of the request)
+  g_millis += 10000;
+  res = exosite.now(&serverTime);
+  CHECK(res.success);
+  CHECK_EQ(res.statusCode, 0);
+  CHECK_EQ(serverTime, 1700000010);
+  CHECK_EQ(client.count("GET /timestamp"), 1);
+
+  // A sample is kept over a less accurate one: a long poll held by the server for 30 s has a
+  // round trip error of +/- 15 s (its `Date` of +100 s is ignored)
+  client.latencyMs = 30000;
+  client.respond("304 Not Modified", "", "Date: Tue, 14 Nov 2023 22:15:10 GMT\r\n");
+  char value[16];
+  CHECK(exosite.longPoll("data_out", value, sizeof(value), 0, 30000).success);
+  exosite.now(&serverTime);
+  CHECK(serverTime >= 1700000040 && serverTime <= 1700000041);
+
+  // ...and replaced by a more accurate one: after 2000 s at 100 ppm, the first sample is +/- 700 ms,
+  // while a quick response is +/- 500 ms (its `Date` of +100 s is taken)
+  g_millis += 2000000;
+  client.latencyMs = 0;
+  client.respond("204 No Content", "", "Date: Tue, 14 Nov 2023 22:48:20 GMT\r\n");
+  CHECK(exosite.write("data_in", "1").success);
+  exosite.now(&serverTime);
+  CHECK_EQ(serverTime, 1700002100);
+  CHECK_EQ(client.count("GET /timestamp"), 1);
+
+  // Once the estimated error exceeds the tolerance, `now()` re-syncs: after 10000 s at 100 ppm,
+  // the error is +/- 1500 ms
+  g_millis += 9990000;
+  CHECK_EQ(exosite.now(&serverTime).statusCode, 0);
+  CHECK_EQ(serverTime, 1700012090);
+
+  exosite.setClockTolerance(1000);
+  client.respond("200 OK", "1700012100");
+  res = exosite.now(&serverTime);
+  CHECK(res.success);
+  CHECK_EQ(res.statusCode, 200);
+  CHECK_EQ(serverTime, 1700012100);
+  CHECK_EQ(client.count("GET /timestamp"), 2);
+
+  // A failed re-sync fails `now()`
+  exosite.setClockTolerance(0);
+  client.respond("500 Internal Server Error");
+  CHECK(!exosite.now(&serverTime).success);
+
+  // The estimate carries across `millis()` wraparound
+  g_millis = (unsigned long)-5000;
+  LatentClient client2;
+  ExositeHTTP exosite2(&client2, "example.com", "token");
+  exosite2.setClockTolerance(2000, 0);
+  client2.respond("200 OK", "1800000000");
+  CHECK_EQ(exosite2.now(&serverTime).statusCode, 200);
+  g_millis += 10000;
+  CHECK(g_millis < 10000);
+  CHECK_EQ(exosite2.now(&serverTime).statusCode, 0);
+  CHECK_EQ(serverTime, 1800000010);
+
+  // ...and across re-basing of the reference point (without drift, it never needs a re-sync)
+  g_millis += 0x50000000UL;
+  CHECK_EQ(exosite2.now(&serverTime).statusCode, 0);
+  CHECK_EQ(serverTime, 1800000010 + 0x50000000UL / 1000);
+  g_millis += 0x50000000UL;
+  CHECK_EQ(exosite2.now(&serverTime).statusCode, 0);
+  CHECK(serverTime - (1800000010 + 0xA0000000UL / 1000) <= 1); // 2684354.56 s (+ the 0.6 s offset)
+  CHECK_EQ(client2.count("GET /timestamp"), 1);
+
+  return testResult("clock");
+}
@@ -0,0 +1,93 @@
+// Deflate compression and inflation (see: `ExositeDeflate`, `setCompression()`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "deflate_vectors.h"
+#include "test.h"
+
+static void appendSink(const uint8_t* data, size_t len, void* context) {
+  static_cast<std::string*>(context)->append((const char*)data, len);
+}
+
+// Compresses and inflates back, returning the compressed length (or 0 on mismatch)
+static size_t roundTrip(const std::string& text) {
+  std::string compressed;
+  ExositeDeflate deflate(appendSink, &compressed);
+  deflate.compress((const uint8_t*)text.data(), text.size());
+  size_t length = deflate.finish();
+  if (length != compressed.size()) {
+    return 0;
+  }
+
+  std::string inflated(text.size() + 16, '\0');
+  long inflatedLen = ExositeDeflate::inflate((const uint8_t*)compressed.data(), compressed.size(),
+                                             (uint8_t*)&inflated[0], inflated.size());
+  if (inflatedLen != (long)text.size() || inflated.compare(0, text.size(), text) != 0) {
+    return 0;
+  }
+  return length;
+}
+
+static bool inflatesTo(const uint8_t* src, size_t srcLen, const char* expected) {
+  uint8_t dest[2048];
+  long len = ExositeDeflate::inflate(src, srcLen, dest, sizeof(dest));
+  return len == (long)strlen(expected) && memcmp(dest, expected, len) == 0;
+}
+
+int main() {
+  // Round trips, from empty to a realistic (repetitive) channel configuration
+  CHECK(roundTrip("") > 0);
+  CHECK(roundTrip("a") > 0);
+  CHECK(roundTrip(std::string(1000, 'x')) > 0);
+  size_t configLen = roundTrip(VECTOR_TEXT);
+  CHECK(configLen > 0 && configLen < strlen(VECTOR_TEXT) / 2);
+
+  std::string noise;
+  srand(1);
+  for (int i = 0; i < 3000; i++) noise += (char)(rand() & 0xFF);
+  CHECK(roundTrip(noise) > 0);
+
+  // Streams from other compressors (dynamic Huffman, stored blocks, gzip)
+  CHECK(inflatesTo(ZLIB_DYNAMIC, sizeof(ZLIB_DYNAMIC), VECTOR_TEXT));
+  CHECK(inflatesTo(RAW_STORED, sizeof(RAW_STORED), VECTOR_TEXT));
+  CHECK(inflatesTo(GZIP_DYNAMIC, sizeof(GZIP_DYNAMIC), VECTOR_TEXT));
+
+  // Insufficient buffer and truncated input fail (rather than overrun)
+  uint8_t small[16];
+  CHECK_EQ(ExositeDeflate::inflate(ZLIB_DYNAMIC, sizeof(ZLIB_DYNAMIC), small, sizeof(small)), -1);
+  uint8_t dest[2048];
+  CHECK_EQ(ExositeDeflate::inflate(ZLIB_DYNAMIC, sizeof(ZLIB_DYNAMIC) / 2, dest, sizeof(dest)), -1);
+
+  // Large request bodies are sent compressed, with a matching Content-Length
+  MockClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  exosite.setCompression(true, 64);
+  const char* config = "{\"channels\":{"
+    "\"001\":{\"display_name\":\"Input 1\",\"properties\":{\"data_type\":\"NUMBER\",\"precision\":2}},"
+    "\"002\":{\"display_name\":\"Input 2\",\"properties\":{\"data_type\":\"NUMBER\",\"precision\":2}}}}";
+  client.respond("204 No Content");
+  CHECK(exosite.write("config_io", config).success);
+
+  std::string request = client.lastRequest();
+  CHECK(request.find("Content-Encoding: deflate\r\n") != std::string::npos);
+  size_t bodyStart = request.find("\r\n\r\n") + 4;
+  std::string body = request.substr(bodyStart);
+  size_t contentLength = strtoul(request.c_str() + request.find("Content-Length: ") + 16, nullptr, 10);
+  CHECK_EQ(body.size(), contentLength);
+
+  long len = ExositeDeflate::inflate((const uint8_t*)body.data(), body.size(), dest, sizeof(dest) - 1);
+  CHECK(len > 0);
+  dest[len > 0 ? len : 0] = '\0';
+  CHECK(strncmp((const char*)dest, "config_io=%7B%22channels%22", 27) == 0);
+
+  // Compressed responses are inflated before parsing
+  std::string compressed;
+  ExositeDeflate deflate(appendSink, &compressed);
+  deflate.compress((const uint8_t*)"data_out=%7B%22on%22%3Atrue%7D", 30);
+  deflate.finish();
+  client.respond("200 OK", compressed, "Content-Encoding: deflate\r\n");
+  char value[32];
+  CHECK(exosite.read("data_out", value, sizeof(value)).success);
+  CHECK_STR(value, "{\"on\":true}");
+
+  return testResult("deflate");
+}
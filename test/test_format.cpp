@@ -0,0 +1,94 @@
+// Numeric formatting (see: `formatNumber()`, `formatInteger()`)
+#include "ExositeHTTP.h"
+#include "test.h"
+#include <float.h>
+#include <limits.h>
+
+static const char* fixed(double value, unsigned int precision) {
+  static char buffer[32];
+  ExositeHTTP::formatNumber(value, precision, buffer);
+  return buffer;
+}
+
+static const char* shortest(double value, unsigned int precision) {
+  static char buffer[32];
+  ExositeHTTP::formatNumber(value, precision, buffer, NUMBER_FORMAT_SHORTEST);
+  return buffer;
+}
+
+static const char* integer(long value) {
+  static char buffer[24];
+  ExositeHTTP::formatInteger(value, buffer);
+  return buffer;
+}
+
+int main() {
+  // Fixed and shortest decimal places
+  CHECK_STR(fixed(0, 2), "0.00");
+  CHECK_STR(shortest(0, 2), "0");
+  CHECK_STR(fixed(21.5, 2), "21.50");
+  CHECK_STR(shortest(21.5, 2), "21.5");
+  CHECK_STR(fixed(3.14159, 0), "3");
+  CHECK_STR(fixed(3.14159, 5), "3.14159");
+  CHECK_STR(fixed(99.995, 2), "100.00");
+  CHECK_STR(shortest(99.995, 2), "100");
+  CHECK_STR(fixed(-7.25, 2), "-7.25");
+  CHECK_STR(fixed(0.1, 12), "0.100000000"); // Limited to 9 decimal places
+
+  // No negative zero
+  CHECK_STR(fixed(-0.001, 2), "0.00");
+  CHECK_STR(shortest(-0.004, 2), "0");
+
+  // Around 32 bits (digit pairs vs. 64-bit division)
+  CHECK_STR(fixed(4294967295.0, 0), "4294967295");
+  CHECK_STR(fixed(4294967296.5, 2), "4294967296.50");
+
+  // Precision is reduced from 1e18, then exponent notation is used from 1.8e19
+  CHECK_STR(fixed(1e17, 2), "100000000000000000");
+  CHECK_STR(fixed(1e18, 2), "1000000000000000000");
+  CHECK_STR(fixed(1.7e19, 2), "17000000000000000000");
+  CHECK_STR(fixed(1.8e19, 2), "1.8e19");
+  CHECK_STR(fixed(2e19, 2), "2e19");
+  CHECK_STR(fixed(-2e19, 2), "-2e19");
+  CHECK_STR(fixed(123456789012345678e9, 2), "1.23456789012346e26");
+  CHECK_STR(fixed(1e300, 2), "1e300");
+  CHECK_STR(fixed(1.5e301, 2), "1.5e301");
+  CHECK_STR(fixed(DBL_MAX, 2), "1.79769313486232e308");
+  CHECK_STR(fixed(-DBL_MAX, 2), "-1.79769313486232e308");
+  CHECK_STR(fixed(9.999999999999999e22, 2), "1e23");
+
+  // Non-finite values
+  CHECK_STR(fixed(NAN, 2), "null");
+  CHECK_STR(fixed(INFINITY, 2), "null");
+  CHECK_STR(fixed(-INFINITY, 2), "null");
+
+  // Integers
+  CHECK_STR(integer(0), "0");
+  CHECK_STR(integer(-7), "-7");
+  CHECK_STR(integer(100), "100");
+  CHECK_STR(integer(-2147483647L - 1), "-2147483648");
+  char expected[24];
+  snprintf(expected, sizeof(expected), "%ld", LONG_MIN);
+  CHECK_STR(integer(LONG_MIN), expected);
+  snprintf(expected, sizeof(expected), "%ld", LONG_MAX);
+  CHECK_STR(integer(LONG_MAX), expected);
+
+  // Fixed formatting matches printf() (except exact ties, which round away from zero)
+  char buffer[32];
+  int mismatches = 0;
+  srand(1);
+  for (int i = 0; i < 100000; i++) {
+    double value = (rand() - RAND_MAX / 2) / (double)(1 + rand() % 100000);
+    unsigned int precision = rand() % 6;
+    ExositeHTTP::formatNumber(value, precision, buffer);
+    snprintf(expected, sizeof(expected), "%.*f", precision, value);
+    double ulp = nextafter(fabs(value), INFINITY) - fabs(value);
+    bool tie = fabs(fmod(fabs(value) * pow(10, precision), 1.0) - 0.5) <= ulp * pow(10, precision);
+    if (strcmp(buffer, expected) != 0 && strcmp(buffer, expected + 1) != 0 && !tie) {
+      mismatches++;
+    }
+  }
+  CHECK_EQ(mismatches, 0);
+
+  return testResult("format");
+}
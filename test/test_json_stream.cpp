@@ -0,0 +1,104 @@
+// Streaming JSON tokenizer and streamed reads (see: `ExositeJsonStream`, `readStream()`)
+#include "ExositeHTTP.h"
+#include "ExositeJsonStream.h"
+#include "MockClient.h"
+#include "test.h"
+
+struct Values {
+  std::string text;  // `path=value` lines
+  int count = 0;
+};
+
+static void collect(const char* path, const char* value, JsonValueType type, void* context) {
+  Values* values = (Values*)context;
+  values->text += std::string(path) + "=" + value + (type == JSON_STRING ? "\n" : ";\n");
+  values->count++;
+}
+
+static bool parse(const char* document, Values& values) {
+  ExositeJsonStream parser(collect, &values);
+  return parser.feed(document, strlen(document)) && parser.finish();
+}
+
+static bool validNumber(const char* number) {
+  Values values;
+  return parse(number, values) && values.count == 1;
+}
+
+int main() {
+  // Paths join keys and indexes; strings are unescaped
+  Values values;
+  CHECK(parse("{\"channels\":{\"001\":{\"rate\":10000,\"on\":true,\"tags\":[\"a\\\"b\",null,-1.5e3]}}}", values));
+  CHECK_STR(values.text.c_str(),
+            "channels.001.rate=10000;\n"
+            "channels.001.on=true;\n"
+            "channels.001.tags.0=a\"b\n"
+            "channels.001.tags.1=null;\n"
+            "channels.001.tags.2=-1.5e3;\n");
+
+  // JSON number grammar only
+  const char* const valid[] = {"0", "-0", "7", "-12.50", "1e9", "1E+2", "2.5e-3", "[10]"};
+  for (const char* number : valid) {
+    CHECK(validNumber(number));
+  }
+  const char* const invalid[] = {"nan", "inf", "-inf", "0x10", "01", "1.", ".5", "-", "+1", "1e", "1e+",
+                                 "1.5.2", "tru", "nul", "[1-2]", "{\"a\":infinity}"};
+  for (const char* number : invalid) {
+    CHECK(!validNumber(number));
+  }
+
+  // Long strings are truncated (and counted once), keys included
+  std::string longText(70, 'x');
+  std::string document = "{\"" + longText + "\":\"" + longText + "\",\"b\":\"" + longText + "\"}";
+  values = Values();
+  ExositeJsonStream parser(collect, &values);
+  CHECK(parser.feed(document.c_str(), document.size()) && parser.finish());
+  CHECK_EQ(parser.truncations(), 3);
+  std::string kept(EXO_JSON_VALUE_SIZE - 1, 'x');
+  std::string expected = kept + "=" + kept + "\nb=" + kept + "\n";
+  CHECK_STR(values.text.c_str(), expected.c_str());
+
+  // ... but truncated literals are invalid
+  std::string longNumber(70, '1');
+  values = Values();
+  CHECK(!parse(longNumber.c_str(), values));
+
+  // Structure errors
+  const char* const malformed[] = {"{\"a\" 1}", "[1,]", "{\"a\":1,}", "[1 2]", "\"a\nb\"", "{1:2}", "[1]]"};
+  for (const char* json : malformed) {
+    values = Values();
+    CHECK(!parse(json, values));
+  }
+  std::string deep(EXO_JSON_MAX_DEPTH + 1, '[');
+  values = Values();
+  CHECK(!parse(deep.c_str(), values));
+
+  // Streamed reads decode the value into the tokenizer as it arrives
+  MockClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  values = Values();
+  ExositeJsonStream config(collect, &values);
+  client.respond("200 OK", "config_io=%7B%22rate%22%3A500%7D");
+  CHECK(exosite.readStream("config_io", ExositeJsonStream::sink, &config).success);
+  CHECK(config.finish());
+  CHECK_STR(values.text.c_str(), "rate=500;\n");
+  CHECK(client.open);
+
+  // A body cut short closes the connection, so its rest is not read as the next response
+  int stops = client.stops;
+  client.responses.push_back("HTTP/1.1 200 OK\r\nContent-Length: 40\r\n\r\nconfig_io=%7B");
+  config.reset();
+  CHECK(!exosite.readStream("config_io", ExositeJsonStream::sink, &config).success);
+  CHECK_EQ(client.stops, stops + 1);
+  CHECK(!client.open);
+
+  // ... as do an unexpected status and a malformed body
+  client.respond("403 Forbidden", "denied");
+  CHECK_EQ(exosite.readStream("config_io", ExositeJsonStream::sink, &config).statusCode, 403);
+  CHECK(client.open == false && client.connects == 2);
+  client.respond("200 OK", "config_io=%7");
+  CHECK(!exosite.readStream("config_io", ExositeJsonStream::sink, &config).success);
+  CHECK(client.open == false && client.connects == 3);
+
+  return testResult("json_stream");
+}
@@ -0,0 +1,122 @@
+// Library log backend (see: `ExositeLog`, `LOG_ERROR()`, `LOG_DEBUG()`)
+#include "ExositeLog.h"
+#include "test.h"
+#include <string>
+
+// Output capturing everything printed
+struct Capture : public Print {
+  std::string text;
+
+  size_t write(uint8_t c) override { text += (char)c; return 1; }
+
+  std::string take() {
+    std::string taken = text;
+    text.clear();
+    return taken;
+  }
+};
+
+// Checks (and clears) the captured output
+#define CHECK_OUTPUT(capture, expected) \
+  do { \
+    std::string output_ = (capture).take(), expected_ = (expected); \
+    CHECK_STR(output_.c_str(), expected_.c_str()); \
+  } while (0)
+
+static std::string prefix(int line) {
+  return "ERROR (line:" + std::to_string(line) + ") ";
+}
+
+static int evaluated = 0;
+
+static int sideEffect() {
+  return ++evaluated;
+}
+
+int main() {
+  Capture capture;
+  ExositeLog::setOutput(&capture);
+
+  // Synchronous records are printed as logged
+  LOG_ERROR(F("Status: "), 404); int line = __LINE__;
+  CHECK_OUTPUT(capture, prefix(line) + "Status: 404\r\n");
+  CHECK_EQ(ExositeLog::pending(), 0);
+
+  // Deferred records are stored until drained, with each argument type decoded
+  ExositeLog::setDeferred(true);
+  char text[64] = "copied";
+  LOG_ERROR(F("flash "), text, F(" "), -42L, F(" "), 4000000000UL, F(" "), 2.41, F(" "), String("s")); line = __LINE__;
+  strcpy(text, "overwritten"); // RAM strings are copied when logged
+  CHECK_EQ(capture.text.size(), 0);
+  CHECK(ExositeLog::pending() > 0);
+  CHECK_EQ(ExositeLog::drain(), 1);
+  CHECK_OUTPUT(capture, prefix(line) + "flash copied -42 4000000000 2.41 s\r\n");
+  CHECK_EQ(ExositeLog::pending(), 0);
+
+  // Long RAM strings are truncated to `EXO_LOG_MAX_STRING`
+  std::string longText(EXO_LOG_MAX_STRING + 10, 'x');
+  LOG_ERROR(longText.c_str()); line = __LINE__;
+  ExositeLog::drain();
+  CHECK_OUTPUT(capture, prefix(line) + std::string(EXO_LOG_MAX_STRING, 'x') + "\r\n");
+
+  // Records wrap around the end of the ring (16 B each: header, type, length, and 10 bytes)
+  std::string expected;
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < 10; i++) {
+      char record[16];
+      snprintf(record, sizeof(record), "record-%03d", round * 10 + i);
+      LOG_ERROR(record); line = __LINE__;
+      expected += prefix(line) + record + "\r\n";
+    }
+    CHECK_EQ(ExositeLog::pending(), 160);
+    CHECK_EQ(ExositeLog::drain(), 10);
+  }
+  CHECK_OUTPUT(capture, expected);
+
+  // Records that do not fit are dropped whole, and reported by the next drain
+  for (int i = 0; i < 20; i++) {
+    LOG_ERROR("0123456789");
+  }
+  CHECK_EQ(ExositeLog::pending(), EXO_LOG_RING_SIZE);
+  CHECK_EQ(ExositeLog::drain(4), 4);
+  std::string drained = capture.take();
+  CHECK(drained.find("WARN (log) Records dropped: 4\r\n") == 0);
+  CHECK_EQ(ExositeLog::pending(), EXO_LOG_RING_SIZE - 64);
+  CHECK_EQ(ExositeLog::drain(), 12);
+  CHECK(capture.take().find("dropped") == std::string::npos);
+
+  // Disabling deferred logging prints pending records first
+  LOG_ERROR(F("pending")); line = __LINE__;
+  ExositeLog::setDeferred(false);
+  CHECK_OUTPUT(capture, prefix(line) + "pending\r\n");
+
+  // Runtime filtering skips the record (and evaluating its arguments)
+  ExositeLog::setLevel(EXO_LOG_LEVEL_NONE);
+  CHECK(!ExositeLog::enabled(EXO_LOG_LEVEL_ERROR));
+  LOG_ERROR(F("filtered "), sideEffect());
+  CHECK_EQ(capture.text.size(), 0);
+  CHECK_EQ(evaluated, 0);
+
+  // ...and cannot enable levels above `EXO_LOG_LEVEL`
+  ExositeLog::setLevel(EXO_LOG_LEVEL_DEBUG);
+  CHECK(ExositeLog::enabled(EXO_LOG_LEVEL_ERROR));
+  CHECK_EQ(ExositeLog::enabled(EXO_LOG_LEVEL_DEBUG), EXO_LOG_LEVEL >= EXO_LOG_LEVEL_DEBUG);
+  LOG_ERROR(F("error "), sideEffect());
+  CHECK_EQ(evaluated, 1);
+  capture.take();
+
+  // Levels above `EXO_LOG_LEVEL` are removed at compile time
+#if EXO_LOG_LEVEL < EXO_LOG_LEVEL_DEBUG
+  LOG_DEBUG(F("stripped "), sideEffect());
+  CHECK_EQ(capture.text.size(), 0);
+  CHECK_EQ(evaluated, 1);
+#endif
+
+  // Without an output, records are discarded
+  ExositeLog::setOutput(nullptr);
+  LOG_ERROR(F("discarded"));
+  ExositeLog::setOutput(&capture);
+  CHECK_EQ(capture.text.size(), 0);
+
+  return testResult("log");
+}
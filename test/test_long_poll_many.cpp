@@ -0,0 +1,89 @@
+// Long polling of several resources in one request (see: `longPollMany()`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "test.h"
+
+int main() {
+  MockClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  char config[32];
+  char control[32];
+  PollResource resources[] = {
+    {"config_io", config, sizeof(config), 0, false, 0},
+    {"data_out", control, sizeof(control), 0, false, 0},
+  };
+
+  // A single request queries all resources, from the oldest cursor
+  client.respond("200 OK", "config_io=v1&data_out=on", "Last-Modified: 1700000000\r\n");
+  ApiResponse res = exosite.longPollMany(resources, 2);
+  CHECK(res.success);
+  CHECK_EQ(res.statusCode, 200);
+  std::string request = client.lastRequest();
+  CHECK(request.find("GET /onep:v1/stack/alias?config_io&data_out ") == 0);
+  CHECK(request.find("If-Modified-Since: 0\r\n") != std::string::npos);
+  CHECK(resources[0].changed && resources[1].changed);
+  CHECK_STR(config, "v1");
+  CHECK_STR(control, "on");
+  CHECK_EQ(resources[0].lastModified, 1700000000);
+  CHECK_EQ(resources[1].lastModified, 1700000000);
+
+  // Only values differing from the last received are changed (names are matched decoded)
+  client.respond("200 OK", "config_io=v1&data%5Fout=off%21", "Last-Modified: 1700000060\r\n");
+  CHECK(exosite.longPollMany(resources, 2).success);
+  CHECK(client.lastRequest().find("If-Modified-Since: 1700000000\r\n") != std::string::npos);
+  CHECK(!resources[0].changed);
+  CHECK(resources[1].changed);
+  CHECK_STR(config, "");
+  CHECK_STR(control, "off!");
+  CHECK_EQ(resources[0].lastModified, 1700000060);
+  CHECK_EQ(resources[1].lastModified, 1700000060);
+
+  // No update within the timeout
+  client.respond("304 Not Modified");
+  res = exosite.longPollMany(resources, 2);
+  CHECK(res.success);
+  CHECK_EQ(res.statusCode, 304);
+  CHECK(!resources[0].changed && !resources[1].changed);
+  CHECK_EQ(resources[0].lastModified, 1700000060);
+
+  // A malformed body fails (after any pairs before it)
+  client.respond("200 OK", "config_io=v2&data_out", "Last-Modified: 1700000120\r\n");
+  CHECK(!exosite.longPollMany(resources, 2).success);
+  CHECK(resources[0].changed);
+  CHECK_STR(config, "v2");
+  CHECK(!resources[1].changed);
+
+  // Without `Last-Modified`, the cursors advance to the `Date` time
+  client.respond("200 OK", "config_io=v3&data_out=off%21", "Date: Tue, 14 Nov 2023 22:15:00 GMT\r\n");
+  CHECK(exosite.longPollMany(resources, 2).success);
+  CHECK_EQ(resources[0].lastModified, 1700000100);
+  CHECK_EQ(resources[1].lastModified, 1700000100);
+
+  // Without either, the cursors advance to the estimated server time
+  client.respond("200 OK", "config_io=v4&data_out=off%21");
+  CHECK(exosite.longPollMany(resources, 2).success);
+  CHECK(resources[0].changed);
+  CHECK(resources[0].lastModified >= 1700000100 && resources[0].lastModified <= 1700000101);
+
+  // ...or keep the previous cursors, if the server time is unknown
+  MockClient client2;
+  ExositeHTTP exosite2(&client2, "example.com", "token");
+  resources[0].lastModified = 1700000000;
+  resources[1].lastModified = 1700000000;
+  client2.respond("200 OK", "config_io=v5&data_out=on");
+  CHECK(exosite2.longPollMany(resources, 2).success);
+  CHECK(resources[0].changed);
+  CHECK_EQ(resources[0].lastModified, 1700000000);
+  CHECK_EQ(resources[1].lastModified, 1700000000);
+
+  // A missing resource or buffer is rejected without a request
+  size_t written = client.out.size();
+  PollResource missing[] = {{nullptr, config, sizeof(config), 0, false, 0}};
+  CHECK(!exosite.longPollMany(missing, 1).success);
+  missing[0] = {"config_io", nullptr, 0, 0, false, 0};
+  CHECK(!exosite.longPollMany(missing, 1).success);
+  CHECK(!exosite.longPollMany(nullptr, 1).success);
+  CHECK_EQ(client.out.size(), written);
+
+  return testResult("long_poll_many");
+}
@@ -0,0 +1,110 @@
+// Heap-free request paths (see: `EXO_NO_HEAP`); built with `EXO_NO_HEAP` and allocation counters
+#include "ExositeHTTP.h"
+#include "test.h"
+#include <new>
+#include <string>
+#include <stdlib.h>
+
+#ifndef EXO_NO_HEAP
+  #error "Build with -DEXO_NO_HEAP (see: Makefile)"
+#endif
+
+// Allocations made through `new` (any code) or `malloc()` (the library and stubs, see: `--wrap`)
+static unsigned long allocations = 0;
+
+extern "C" {
+  void* __real_malloc(size_t size);
+  void* __real_calloc(size_t count, size_t size);
+  void* __real_realloc(void* ptr, size_t size);
+  void* __wrap_malloc(size_t size) { allocations++; return __real_malloc(size); }
+  void* __wrap_calloc(size_t count, size_t size) { allocations++; return __real_calloc(count, size); }
+  void* __wrap_realloc(void* ptr, size_t size) { allocations++; return __real_realloc(ptr, size); }
+}
+
+void* operator new(size_t size) {
+  allocations++;
+  void* ptr = __real_malloc(size ? size : 1);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { free(ptr); }
+
+// Client with fixed buffers (serves the same response to every request)
+struct FixedClient : public Client {
+  const char* response = "";
+  size_t pos = 0;
+  size_t written = 0;
+  bool open = false;
+  bool pending = false;
+
+  int connect(IPAddress, uint16_t) override { return connect("", 0); }
+  int connect(const char*, uint16_t) override { open = true; return 1; }
+  size_t write(uint8_t) override { return write(nullptr, 1); }
+  size_t write(const uint8_t*, size_t size) override {
+    written += size;
+    if (!pending) { pending = true; pos = 0; }
+    return size;
+  }
+  int available() override { return pending ? strlen(response) - pos : 0; }
+  int read() override {
+    if (!available()) return -1;
+    int c = (uint8_t)response[pos++];
+    if (!response[pos]) pending = false;
+    return c;
+  }
+  int read(uint8_t* buf, size_t size) override {
+    size_t i = 0;
+    while (i < size && available()) buf[i++] = read();
+    return i;
+  }
+  int peek() override { return available() ? (uint8_t)response[pos] : -1; }
+  void flush() override {}
+  void stop() override { open = false; pending = false; }
+  uint8_t connected() override { return open; }
+  operator bool() override { return open; }
+};
+
+static const char* const NO_CONTENT = "HTTP/1.1 204 No Content\r\nContent-Length: 0\r\n\r\n";
+static const char* const VALUE = "HTTP/1.1 200 OK\r\nContent-Length: 11\r\n\r\ndata_out=on";
+
+int main() {
+  FixedClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  char value[32];
+  ValueView view;
+
+  // First calls may initialize the stubs (e.g. stdio buffers)
+  client.response = NO_CONTENT;
+  CHECK(exosite.write("data_in", "{\"001\":1}").success);
+
+  unsigned long before = allocations;
+  for (int i = 0; i < 100; i++) {
+    client.response = NO_CONTENT;
+    CHECK(exosite.write("data_in", "{\"001\":1}").success);
+
+    exosite.beginChannels();
+    exosite.addChannel("001", 21.5);
+    exosite.addChannel("002", i);
+    CHECK(exosite.writeChannels("data_in").success);
+
+    client.response = VALUE;
+    CHECK(exosite.read("data_out", value, sizeof(value)).success);
+    CHECK(exosite.read("data_out", view).success);
+    CHECK(exosite.longPoll("data_out", value, sizeof(value), 0, 1000).success);
+  }
+  CHECK_STR(value, "on");
+  CHECK_EQ(allocations - before, 0);
+
+  // The counters see allocations
+  before = allocations;
+  void* volatile block = malloc(16);
+  free(block);
+  std::string text(64, 'x');
+  CHECK_EQ(allocations - before, 2);
+
+  return testResult("no_heap");
+}
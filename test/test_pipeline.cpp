@@ -0,0 +1,79 @@
+// Request pipelining (see: `beginPipeline()`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "test.h"
+
+static std::string readValues;
+
+static void onRead(const char* resource, const char* value) {
+  readValues += std::string(resource) + "=" + value + ";";
+}
+
+int main() {
+  MockClient client;
+  client.batch = true;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  ApiResponse results[4];
+
+  // Responses are matched to requests in order, on one connection
+  exosite.beginPipeline();
+  CHECK(exosite.pipelineWrite("data_in", "1"));
+  CHECK(exosite.pipelineRead("data_out"));
+  CHECK(exosite.pipelineRead("config_io"));
+  client.respond("204 No Content");
+  client.respond("200 OK", "data_out=on");
+  client.respond("200 OK", "config_io=%7B%7D");
+  CHECK_EQ(exosite.endPipeline(results, 4, onRead), 3);
+  CHECK(results[0].success && results[0].statusCode == 204);
+  CHECK(results[1].success && results[1].statusCode == 200);
+  CHECK(results[2].success && results[2].statusCode == 200);
+  CHECK_STR(readValues.c_str(), "data_out=on;config_io={};");
+  CHECK_EQ(client.connects, 1);
+
+  // A lost connection stops the pipeline (no new connection is opened for later requests)
+  readValues.clear();
+  exosite.beginPipeline();
+  CHECK(exosite.pipelineRead("data_out"));
+  client.open = false;
+  CHECK(!exosite.pipelineWrite("data_in", "2"));
+  CHECK(!exosite.pipelineRead("config_io"));
+  client.respond("200 OK", "data_out=off");
+  CHECK_EQ(exosite.endPipeline(results, 4, onRead), 3);
+  CHECK(results[0].success);
+  CHECK(!results[1].success && results[1].statusCode == 0);
+  CHECK(!results[2].success && results[2].statusCode == 0);
+  CHECK_STR(readValues.c_str(), "data_out=off;");
+  CHECK_EQ(client.connects, 1);
+  CHECK_EQ(client.count("data_in=2"), 0);
+
+  // With retry, unsent requests are re-sent one at a time on a new connection
+  client.batch = false; // One response per request from here on
+  int connects = client.connects;
+  exosite.beginPipeline(true);
+  CHECK(exosite.pipelineRead("data_out"));
+  client.open = false;
+  CHECK(!exosite.pipelineWrite("data_in", "3"));
+  client.respond("200 OK", "data_out=on");
+  client.respond("204 No Content");
+  CHECK_EQ(exosite.endPipeline(results, 4), 2);
+  CHECK(results[0].success && results[0].statusCode == 200);
+  CHECK(results[1].success && results[1].statusCode == 204);
+  CHECK_EQ(client.count("data_in=3"), 1);
+  CHECK_EQ(client.connects, connects + 2); // Pipeline connection, then the retry
+
+  // With retry, unanswered reads are re-sent, but never unanswered writes
+  exosite.beginPipeline(true);
+  CHECK(exosite.pipelineWrite("data_in", "4"));
+  CHECK(exosite.pipelineWrite("data_in", "5"));
+  CHECK(exosite.pipelineRead("data_out"));
+  client.respond("204 No Content", "", "Connection: close\r\n");
+  client.respond("200 OK", "data_out=off");
+  CHECK_EQ(exosite.endPipeline(results, 4), 3);
+  CHECK(results[0].success);
+  CHECK(!results[1].success && results[1].statusCode == 0);
+  CHECK(results[2].success && results[2].statusCode == 200);
+  CHECK_EQ(client.count("data_in=5"), 1);
+  CHECK_EQ(client.count("GET /onep:v1/stack/alias?data_out"), 5);
+
+  return testResult("pipeline");
+}
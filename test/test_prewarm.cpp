@@ -0,0 +1,90 @@
+// Connection pre-warming ahead of scheduled requests (see: `prewarm()`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "test.h"
+
+static MockClient client;
+static ExositeHTTP exosite(&client, "example.com", "token");
+
+// Writes at the given time (ms), then lets the server close the connection
+static void writeAt(unsigned long time) {
+  g_millis = time;
+  client.respond("204 No Content");
+  CHECK(exosite.write("data_in", "1").success);
+  client.open = false;
+}
+
+int main() {
+  g_millisStep = 0; // Time only passes as set (or by `delay()`)
+
+  // The interval is unknown until two requests were made
+  writeAt(100000);
+  g_millis = 200000;
+  CHECK(!exosite.prewarm());
+  CHECK_EQ(client.connects, 1);
+
+  writeAt(160000); // Interval: 60 s
+  ConnectionStats stats = exosite.getConnectionStats();
+  CHECK_EQ(stats.coldStarts, 2);
+  CHECK_EQ(stats.warmHits, 0);
+
+  // Connects once within the lead time (default: 5 s) of the next expected request
+  g_millis = 160000 + 54999;
+  CHECK(!exosite.prewarm());
+  CHECK_EQ(client.connects, 2);
+  g_millis = 160000 + 55000;
+  CHECK(exosite.prewarm());
+  CHECK_EQ(client.connects, 3);
+  CHECK_EQ(exosite.getConnectionStats().prewarms, 1);
+  CHECK(exosite.prewarm()); // Already open
+  CHECK_EQ(client.connects, 3);
+
+  // The request then finds the connection warm
+  writeAt(220000);
+  stats = exosite.getConnectionStats();
+  CHECK_EQ(stats.warmHits, 1);
+  CHECK_EQ(stats.coldStarts, 2);
+  CHECK_EQ(client.connects, 3);
+
+  // The interval is a moving average: (3 x 60 s + 100 s) / 4 = 70 s
+  writeAt(320000);
+  CHECK_EQ(exosite.getConnectionStats().coldStarts, 3);
+  g_millis = 320000 + 64999;
+  CHECK(!exosite.prewarm());
+  g_millis = 320000 + 65000;
+  CHECK(exosite.prewarm());
+
+  // A connection lost after pre-warming is not re-opened until the next request
+  client.open = false;
+  CHECK(!exosite.prewarm());
+  int connects = client.connects;
+  writeAt(390000);
+  CHECK_EQ(client.connects, connects + 1);
+  CHECK_EQ(exosite.getConnectionStats().coldStarts, 4);
+
+  // A longer lead time connects earlier: expected at 390 + (3 x 70 s + 70 s) / 4 = 460 s
+  g_millis = 390000 + 49999;
+  CHECK(!exosite.prewarm(20000));
+  g_millis = 390000 + 50000;
+  CHECK(exosite.prewarm(20000));
+  CHECK_EQ(exosite.getConnectionStats().prewarms, 3);
+  client.open = false;
+
+  // A failed pre-warm is not counted, nor retried before the next request
+  writeAt(460000);
+  client.refuse = true;
+  g_millis = 460000 + 65000;
+  CHECK(!exosite.prewarm());
+  CHECK(!exosite.prewarm());
+  stats = exosite.getConnectionStats();
+  CHECK_EQ(stats.prewarms, 3);
+  CHECK_EQ(stats.connectFailures, 1);
+  client.refuse = false;
+
+  writeAt(530000);
+  stats = exosite.getConnectionStats();
+  CHECK_EQ(stats.warmHits, 1);
+  CHECK_EQ(stats.coldStarts, 6);
+
+  return testResult("prewarm");
+}
@@ -0,0 +1,96 @@
+// AIMD send-rate control (see: `ExositeRateController`)
+#include "ExositeRateController.h"
+#include "test.h"
+
+static ApiResponse response(bool success, int statusCode) {
+  ApiResponse res;
+  res.success = success;
+  res.statusCode = statusCode;
+  return res;
+}
+
+int main() {
+  const ApiResponse ok = response(true, 204);
+  const ApiResponse busy = response(false, 429);
+  const ApiResponse denied = response(false, 403);
+
+  ExositeRateController rate(1000, 8000, 4);
+  CHECK_EQ(rate.interval(), 1000);
+  CHECK_EQ(rate.batchSize(), 1);
+  CHECK(rate.due());
+
+  // Multiplicative decrease: the interval and batch double, up to their maximum
+  rate.update(busy, 0);
+  CHECK_EQ(rate.interval(), 2000);
+  CHECK_EQ(rate.batchSize(), 2);
+  CHECK_EQ(rate.backoffs(), 1);
+  CHECK(!rate.due());
+
+  // Once per interval only
+  rate.update(busy, 0);
+  CHECK_EQ(rate.interval(), 2000);
+  CHECK_EQ(rate.backoffs(), 1);
+
+  for (int i = 0; i < 3; i++) {
+    g_millis += rate.interval();
+    rate.update(response(false, 0), 0);
+  }
+  CHECK_EQ(rate.interval(), 8000);
+  CHECK_EQ(rate.batchSize(), 4);
+  CHECK_EQ(rate.backoffs(), 4);
+  CHECK(rate.rate() == 7.5f);
+
+  // Client errors are not congestion
+  g_millis += rate.interval();
+  rate.update(denied, 0);
+  CHECK_EQ(rate.interval(), 8000);
+
+  // Additive increase: the interval shrinks by the step (min / 4) after each timely success
+  rate.update(ok, 200);
+  CHECK_EQ(rate.interval(), 7750);
+  CHECK_EQ(rate.batchSize(), 3);
+  rate.setStep(3000);
+  rate.update(ok, 200);
+  rate.update(ok, 200);
+  CHECK_EQ(rate.interval(), 1750);
+  CHECK_EQ(rate.batchSize(), 1);
+  rate.update(ok, 200);
+  CHECK_EQ(rate.interval(), 1000);
+  CHECK_EQ(rate.latency(), 200);
+
+  // Success without a round-trip time leaves the rate unchanged
+  rate.update(ok, 0);
+  CHECK_EQ(rate.interval(), 1000);
+
+  // Slow responses (smoothed over 8 samples) back off past twice the target latency
+  rate.setTargetLatency(100);
+  g_millis += rate.interval();
+  rate.update(ok, 200);
+  CHECK_EQ(rate.interval(), 1000);
+  rate.update(ok, 1000);
+  CHECK_EQ(rate.latency(), 300);
+  CHECK_EQ(rate.interval(), 2000);
+
+  // ...but not once the latest round trip is timely again (while the average still lags)
+  g_millis += rate.interval();
+  rate.update(ok, 50);
+  CHECK(rate.latency() > 200);
+  CHECK_EQ(rate.interval(), 1000);
+
+  // A zero minimum interval is clamped to 1 ms, so the rate stays finite and backoffs grow
+  ExositeRateController fast(0, 0);
+  CHECK_EQ(fast.interval(), 1);
+  CHECK(fast.rate() == 60000.0f);
+  fast.update(busy, 0);
+  CHECK_EQ(fast.interval(), 1);
+  ExositeRateController open(0, 100);
+  open.update(busy, 0);
+  CHECK_EQ(open.interval(), 2);
+  g_millis += 2;
+  open.update(busy, 0);
+  CHECK_EQ(open.interval(), 4);
+  open.update(ok, 10);
+  CHECK_EQ(open.interval(), 3);
+
+  return testResult("rate_controller");
+}
@@ -0,0 +1,56 @@
+// Conditional reads of cached resources (see: `setReadCache()`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "test.h"
+
+int main() {
+  MockClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  char configBuffer[32];
+  ReadCacheEntry cache[] = {{"config_io", configBuffer, sizeof(configBuffer), 0, false}};
+  exosite.setReadCache(cache, 1);
+  char value[32];
+
+  // A first read transfers the value (miss), later ones revalidate it (hit)
+  client.respond("200 OK", "config_io=v1", "Last-Modified: 1700000000\r\n");
+  CHECK(exosite.read("config_io", value, sizeof(value)).success);
+  CHECK_STR(value, "v1");
+  CHECK(client.lastRequest().find("If-Modified-Since") == std::string::npos);
+
+  client.respond("304 Not Modified");
+  ApiResponse res = exosite.read("config_io", value, sizeof(value));
+  CHECK(res.success && res.statusCode == 304);
+  CHECK_STR(value, "v1");
+  CHECK(client.lastRequest().find("If-Modified-Since: 1700000000") != std::string::npos);
+
+  ReadCacheStats stats = exosite.getReadCacheStats();
+  CHECK_EQ(stats.hits, 1);
+  CHECK_EQ(stats.misses, 1);
+  CHECK_EQ(stats.bytesSaved, 2);
+
+  // Failed reads of a cached resource are misses too
+  client.refuse = true;
+  client.stop();
+  CHECK(!exosite.read("config_io", value, sizeof(value)).success);
+  client.refuse = false;
+  client.respond("500 Internal Server Error");
+  CHECK(!exosite.read("config_io", value, sizeof(value)).success);
+  stats = exosite.getReadCacheStats();
+  CHECK_EQ(stats.hits, 1);
+  CHECK_EQ(stats.misses, 3);
+
+  // Uncached resources are not counted
+  client.respond("200 OK", "data_out=on");
+  CHECK(exosite.read("data_out", value, sizeof(value)).success);
+  CHECK_EQ(exosite.getReadCacheStats().misses, 3);
+
+  // A missing resource name is rejected by the server, rather than looked up
+  client.respond("400 Bad Request");
+  CHECK(!exosite.read((const char*)nullptr, value, sizeof(value)).success);
+  ValueView view;
+  client.respond("400 Bad Request");
+  CHECK(!exosite.read((const char*)nullptr, view).success);
+  CHECK_EQ(exosite.getReadCacheStats().misses, 3);
+
+  return testResult("read_cache");
+}
@@ -0,0 +1,89 @@
+// Wire transcript recording and playback (see: `ExositeRecorder`, `ExositeReplayClient`)
+#include "ExositeHTTP.h"
+#include "ExositeReplay.h"
+#include "MockClient.h"
+#include "test.h"
+
+struct StringPrint : public Print {
+  std::string data;
+  size_t write(uint8_t c) override { data += (char)c; return 1; }
+};
+
+// Runs the same session against any client
+static void session(Client* client, ApiResponse* results, char* value, size_t valueSize) {
+  ExositeHTTP exosite(client, "example.com", "token");
+  results[0] = exosite.write("data_in", "{\"001\":1}");
+  results[1] = exosite.read("data_out", value, valueSize);
+  client->stop();
+}
+
+int main() {
+  // Record a session against the scripted server
+  MockClient server;
+  server.respond("204 No Content");
+  server.respond("200 OK", "data_out=on");
+  StringPrint transcript;
+  ExositeRecorder recorder(&server, &transcript);
+
+  ApiResponse recorded[2];
+  char value[16] = "";
+  session(&recorder, recorded, value, sizeof(value));
+  recorder.flushRecord();
+  CHECK(recorded[0].success && recorded[1].success);
+  CHECK_STR(value, "on");
+
+  const uint8_t* data = (const uint8_t*)transcript.data.data();
+  size_t length = transcript.data.size();
+  CHECK(length > server.out.size());
+  CHECK_EQ(data[0], TRANSCRIPT_STOP);     // Stale connection closed before connecting
+  CHECK_EQ(data[1], 0);                   // Delay of the first record
+  CHECK_EQ(data[2], 0);                   // Length
+  CHECK_EQ(data[3], TRANSCRIPT_CONNECT);
+  CHECK_EQ(data[5], 1);
+  CHECK_EQ(data[6], 1);                   // Connected
+  CHECK_EQ(data[7], TRANSCRIPT_TX);
+  CHECK_EQ(data[length - 3], TRANSCRIPT_STOP);
+
+  // Playback gives the same results, and the library sends the same bytes
+  ExositeReplayClient replay(data, length);
+  ApiResponse replayed[2];
+  char replayedValue[16] = "";
+  session(&replay, replayed, replayedValue, sizeof(replayedValue));
+  CHECK(replay.finished());
+  CHECK_EQ(replay.mismatches(), 0);
+  CHECK_EQ(replayed[0].statusCode, 204);
+  CHECK_EQ(replayed[1].statusCode, 200);
+  CHECK_STR(replayedValue, "on");
+
+  // A diverging request is counted, and does not stop playback
+  ExositeReplayClient diverged(data, length);
+  ExositeHTTP exosite(&diverged, "example.com", "token");
+  CHECK(exosite.write("data_in", "{\"001\":2}").success);
+  CHECK(diverged.mismatches() > 0);
+
+  // Real-time playback holds received data back until its recorded delay has elapsed
+  const uint8_t timed[] = {
+    TRANSCRIPT_CONNECT, 0, 1, 1,
+    TRANSCRIPT_TX, 0, 2, 'h', 'i',
+    TRANSCRIPT_RX, 0x90, 0x03, 2, 'o', 'k',  // After 400 ms
+    TRANSCRIPT_CLOSE, 10, 0
+  };
+  ExositeReplayClient paced(timed, sizeof(timed));
+  paced.setSpeed(2);
+  CHECK_EQ(paced.connect("example.com", 443), 1);
+  CHECK_EQ(paced.write((const uint8_t*)"hi", 2), 2);
+  CHECK_EQ(paced.available(), 0);
+  g_millis += 200;
+  CHECK_EQ(paced.available(), 2);
+  CHECK_EQ(paced.read(), 'o');
+  CHECK_EQ(paced.read(), 'k');
+  CHECK(paced.connected());
+  g_millis += 5;
+  CHECK(!paced.connected());
+  CHECK(paced.finished());
+
+  // Playback past the end refuses further connections
+  CHECK_EQ(paced.connect("example.com", 443), 0);
+
+  return testResult("replay");
+}
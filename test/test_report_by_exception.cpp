@@ -0,0 +1,88 @@
+// Report-by-exception filtering of writes (see: `setReportByException()`, `setDeadband()`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "test.h"
+
+// Writes the value, answering a sent request with the given status
+static ApiResponse writeValue(ExositeHTTP& exosite, MockClient& client, const char* resource,
+                              const char* value, const char* status="204 No Content") {
+  client.responses.clear();
+  client.respond(status);
+  return exosite.write(resource, value);
+}
+
+int main() {
+  MockClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  exosite.setReportByException(true, 1000);
+  CHECK(exosite.setDeadband("005", 0.5));
+
+  // An unchanged value is suppressed (successfully, as `304`)
+  CHECK(writeValue(exosite, client, "data_in", "{\"001\":1,\"005\":10}").success);
+  ApiResponse res = writeValue(exosite, client, "data_in", "{\"001\":1,\"005\":10}");
+  CHECK(res.success);
+  CHECK_EQ(res.statusCode, 304);
+  CHECK_EQ(client.count("POST "), 1);
+
+  // A change within the deadband (inclusive) is not a change, beyond it is
+  CHECK_EQ(writeValue(exosite, client, "data_in", "{\"001\":1,\"005\":10.5}").statusCode, 304);
+  CHECK_EQ(writeValue(exosite, client, "data_in", "{\"001\":1,\"005\":9.5}").statusCode, 304);
+  CHECK_EQ(writeValue(exosite, client, "data_in", "{\"001\":1,\"005\":10.75}").statusCode, 204);
+
+  // Any change of a channel without a deadband is sent
+  CHECK_EQ(writeValue(exosite, client, "data_in", "{\"001\":2,\"005\":10.75}").statusCode, 204);
+  CHECK_EQ(client.count("POST "), 3);
+
+  ReportStats stats = exosite.getReportStats();
+  CHECK_EQ(stats.sent, 3);
+  CHECK_EQ(stats.suppressed, 3);
+  CHECK_EQ(stats.heartbeats, 0);
+
+  // Deadband values are kept per resource, so each alias is compared to its own last write
+  CHECK_EQ(writeValue(exosite, client, "data_backup", "{\"001\":2,\"005\":20}").statusCode, 204);
+  CHECK_EQ(writeValue(exosite, client, "data_in", "{\"001\":2,\"005\":10.75}").statusCode, 304);
+  CHECK_EQ(writeValue(exosite, client, "data_backup", "{\"001\":2,\"005\":20.25}").statusCode, 304);
+
+  // An unchanged value is written once the heartbeat is due, and counted once sent
+  g_millis += 1001;
+  CHECK_EQ(writeValue(exosite, client, "data_in", "{\"001\":2,\"005\":10.75}").statusCode, 204);
+  CHECK_EQ(writeValue(exosite, client, "data_in", "{\"001\":2,\"005\":10.75}").statusCode, 304);
+  stats = exosite.getReportStats();
+  CHECK_EQ(stats.sent, 5);
+  CHECK_EQ(stats.heartbeats, 1);
+
+  // A failed write does not become the last written value (nor a heartbeat)
+  g_millis += 1001;
+  CHECK(!writeValue(exosite, client, "data_in", "{\"001\":3,\"005\":10.75}", "500 Internal Server Error").success);
+  CHECK_EQ(writeValue(exosite, client, "data_in", "{\"001\":3,\"005\":10.75}").statusCode, 204);
+  CHECK_EQ(writeValue(exosite, client, "data_in", "{\"001\":3,\"005\":10.75}").statusCode, 304);
+  stats = exosite.getReportStats();
+  CHECK_EQ(stats.sent, 6);
+  CHECK_EQ(stats.heartbeats, 1);
+
+  // Non-object values are compared as a whole
+  CHECK_EQ(writeValue(exosite, client, "data_out", "on").statusCode, 204);
+  CHECK_EQ(writeValue(exosite, client, "data_out", "on").statusCode, 304);
+
+  // A value received for a resource clears its history, so echoing it back is written
+  char value[32];
+  client.responses.clear();
+  client.respond("200 OK", "data_out=on");
+  CHECK(exosite.longPoll("data_out", value, sizeof(value)).success);
+  CHECK_EQ(writeValue(exosite, client, "data_out", "on").statusCode, 204);
+  client.respond("200 OK", "data_out=on");
+  CHECK(exosite.read("data_out", value, sizeof(value)).success);
+  CHECK_EQ(writeValue(exosite, client, "data_out", "on").statusCode, 204);
+  CHECK_EQ(writeValue(exosite, client, "data_out", "on").statusCode, 304);
+
+  // Cleared history sends every resource again
+  exosite.clearReportHistory();
+  CHECK_EQ(writeValue(exosite, client, "data_in", "{\"001\":3,\"005\":10.75}").statusCode, 204);
+  CHECK_EQ(writeValue(exosite, client, "data_backup", "{\"001\":2,\"005\":20}").statusCode, 204);
+
+  // Disabled filtering writes every value
+  exosite.setReportByException(false);
+  CHECK_EQ(writeValue(exosite, client, "data_in", "{\"001\":3,\"005\":10.75}").statusCode, 204);
+
+  return testResult("report_by_exception");
+}
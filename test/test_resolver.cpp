@@ -0,0 +1,117 @@
+// Server address cache across reconnects (see: `setResolver()`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "test.h"
+
+static const IPAddress serverA(192, 0, 2, 1);
+static const IPAddress serverB(192, 0, 2, 2);
+
+static IPAddress resolvedAddress = serverA; // Address the resolver returns
+static IPAddress downAddress;               // Address refusing connections
+static bool resolverUp = true;
+static int lookups = 0;
+static IPAddress connectedTo;
+
+static bool resolve(const char*, IPAddress& address, unsigned long& ttlSec) {
+  lookups++;
+  delay(40);
+  if (!resolverUp) return false;
+  address = resolvedAddress;
+  ttlSec = 60;
+  return true;
+}
+
+static int connectTo(Client* client, const IPAddress& address, const char*, uint16_t port) {
+  if (address == downAddress) return 0;
+  connectedTo = address;
+  return client->connect(address, port);
+}
+
+// Writes a value over a new connection
+static bool reconnectAndWrite(ExositeHTTP& exosite, MockClient& client) {
+  client.open = false;
+  client.responses.clear();
+  client.respond("204 No Content");
+  return exosite.write("data_in", "1").success;
+}
+
+int main() {
+  g_millisStep = 0; // Time only passes by `delay()` (so lookups take exactly 40 ms)
+
+  MockClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  exosite.setResolver(resolve, connectTo);
+
+  // The first connection looks the address up
+  CHECK(reconnectAndWrite(exosite, client));
+  ConnectionStats stats = exosite.getConnectionStats();
+  CHECK_EQ(lookups, 1);
+  CHECK_EQ(stats.dnsMisses, 1);
+  CHECK_EQ(stats.dnsSavedMs, 0);
+  CHECK(connectedTo == serverA);
+
+  // Within the TTL, reconnects reuse it (saving a lookup each)
+  CHECK(reconnectAndWrite(exosite, client));
+  CHECK(reconnectAndWrite(exosite, client));
+  stats = exosite.getConnectionStats();
+  CHECK_EQ(lookups, 1);
+  CHECK_EQ(stats.dnsHits, 2);
+  CHECK_EQ(stats.dnsSavedMs, 80);
+
+  // Past the TTL, it is looked up again
+  g_millis += 61000;
+  CHECK(reconnectAndWrite(exosite, client));
+  stats = exosite.getConnectionStats();
+  CHECK_EQ(lookups, 2);
+  CHECK_EQ(stats.dnsMisses, 2);
+
+  // A failed lookup falls back to the last known address
+  g_millis += 61000;
+  resolverUp = false;
+  CHECK(reconnectAndWrite(exosite, client));
+  stats = exosite.getConnectionStats();
+  CHECK_EQ(lookups, 3);
+  CHECK_EQ(stats.dnsStale, 1);
+  CHECK(connectedTo == serverA);
+  resolverUp = true;
+
+  CHECK(reconnectAndWrite(exosite, client));
+  CHECK_EQ(lookups, 4);
+
+  // A failed connection to the cached address (e.g. the server moved) discards it, and is
+  // retried with a fresh lookup (whose time was not saved after all)
+  resolvedAddress = serverB;
+  downAddress = serverA;
+  CHECK(reconnectAndWrite(exosite, client));
+  stats = exosite.getConnectionStats();
+  CHECK_EQ(lookups, 5);
+  CHECK(connectedTo == serverB);
+  CHECK_EQ(stats.dnsHits, 3);
+  CHECK_EQ(stats.dnsSavedMs, 80);
+  CHECK_EQ(stats.connectFailures, 0);
+
+  CHECK(reconnectAndWrite(exosite, client));
+  CHECK_EQ(lookups, 5);
+  CHECK_EQ(exosite.getConnectionStats().dnsSavedMs, 120);
+
+  // A failed connection to a freshly resolved address is not retried, but not kept either
+  g_millis += 61000;
+  downAddress = serverB;
+  CHECK(!reconnectAndWrite(exosite, client));
+  CHECK_EQ(lookups, 6);
+  CHECK_EQ(exosite.getConnectionStats().connectFailures, 1);
+
+  downAddress = IPAddress();
+  CHECK(reconnectAndWrite(exosite, client));
+  CHECK_EQ(lookups, 7);
+  CHECK(connectedTo == serverB);
+
+  // Without a resolver, connections are by host name
+  exosite.setResolver(nullptr);
+  connectedTo = IPAddress();
+  CHECK(reconnectAndWrite(exosite, client));
+  CHECK_EQ(lookups, 7);
+  CHECK(connectedTo == IPAddress());
+
+  return testResult("resolver");
+}
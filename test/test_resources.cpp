@@ -0,0 +1,81 @@
+// Resource handles (see: `registerResource()`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "test.h"
+
+static std::string dispatched;
+
+static void onConfig(const char* resource, const char* value) {
+  dispatched += std::string(resource) + "=" + value + ";";
+}
+
+int main() {
+  MockClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  exosite.setEncoding(URL_ENCODING_MINIMAL);
+
+  ResourceHandle data = exosite.registerResource("data_in");
+  ResourceHandle config = exosite.registerResource("cfg/io", onConfig);
+  CHECK_EQ(data, 0);
+  CHECK_EQ(config, 1);
+  CHECK_EQ(exosite.registerResource("data_in"), data); // Already registered
+  CHECK_EQ(exosite.findResource("cfg/io"), config);
+  CHECK_EQ(exosite.findResource("unknown"), -1);
+  CHECK_STR(exosite.resourceName(config), "cfg/io");
+
+  // Aliases are strictly encoded, while values follow the body encoding profile
+  client.respond("204 No Content");
+  CHECK(exosite.write(config, "{\"a\":1}").success);
+  std::string request = client.lastRequest();
+  CHECK(request.find("Content-Length: 16\r\n") != std::string::npos);
+  CHECK(request.find("\r\n\r\ncfg%2Fio={\"a\":1}\r\n") != std::string::npos);
+
+  // The body encoding profile is unchanged by registration
+  client.respond("204 No Content");
+  CHECK(exosite.write("x/y", "{}").success);
+  CHECK(client.lastRequest().find("\r\n\r\nx/y={}\r\n") != std::string::npos);
+
+  // Reads by handle are dispatched to the registered handler
+  char value[32];
+  client.respond("200 OK", "cfg%2Fio=%7B%7D");
+  CHECK(exosite.read(config, value, sizeof(value)).success);
+  CHECK_STR(value, "{}");
+  CHECK_STR(dispatched.c_str(), "cfg/io={};");
+
+  // Report-by-exception history and the read cache are keyed by alias, whether by handle or name
+  exosite.setReportByException(true);
+  client.respond("204 No Content");
+  CHECK_EQ(exosite.write(config, "{\"a\":2}").statusCode, 204);
+  CHECK_EQ(exosite.write("cfg/io", "{\"a\":2}").statusCode, 304);
+  CHECK_EQ(exosite.write(config, "{\"a\":2}").statusCode, 304);
+
+  char cached[32];
+  ReadCacheEntry cache[] = {{"cfg/io", cached, sizeof(cached), 0, false}};
+  exosite.setReadCache(cache, 1);
+  client.respond("200 OK", "cfg%2Fio=%7B%22a%22%3A2%7D", "Last-Modified: 1700000000\r\n");
+  CHECK(exosite.read(config, value, sizeof(value)).success);
+  CHECK_STR(cached, "{\"a\":2}");
+  client.respond("304 Not Modified");
+  ApiResponse res = exosite.read("cfg/io", value, sizeof(value));
+  CHECK(res.success && res.statusCode == 304);
+  CHECK(client.lastRequest().find("If-Modified-Since: 1700000000") != std::string::npos);
+  CHECK_STR(value, "{\"a\":2}");
+
+  // ...so a value read by handle clears the history of the alias
+  client.respond("204 No Content");
+  CHECK_EQ(exosite.write("cfg/io", "{\"a\":2}").statusCode, 204);
+  client.respond("200 OK", "cfg%2Fio=%7B%22a%22%3A2%7D");
+  CHECK(exosite.longPoll(config, value, sizeof(value)).success);
+  client.respond("204 No Content");
+  CHECK_EQ(exosite.write("cfg/io", "{\"a\":2}").statusCode, 204);
+  exosite.setReportByException(false);
+  exosite.setReadCache(nullptr, 0);
+
+  // Invalid handles and a full table
+  CHECK(!exosite.write((ResourceHandle)7, "1").success);
+  CHECK(exosite.registerResource("r3") >= 0);
+  CHECK(exosite.registerResource("r4") >= 0);
+  CHECK_EQ(exosite.registerResource("r5"), -1);
+
+  return testResult("resources");
+}
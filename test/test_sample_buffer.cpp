@@ -0,0 +1,80 @@
+// Windowed sample aggregation (see: `ExositeSampleBuffer`)
+#include "ExositeSampleBuffer.h"
+#include "MockClient.h"
+#include "test.h"
+
+static std::string requestBody(MockClient& client) {
+  std::string request = client.lastRequest();
+  size_t body = request.find("\r\n\r\n");
+  return body == std::string::npos ? std::string() : request.substr(body + 4);
+}
+
+int main() {
+  MockClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  ExositeSampleBuffer samples(10000);
+
+  int temp = samples.addChannel("001", AGGREGATE_MIN | AGGREGATE_MAX | AGGREGATE_MEAN | AGGREGATE_LAST | AGGREGATE_COUNT, 1);
+  int level = samples.addChannel("002");
+  int idle = samples.addChannel("003", AGGREGATE_LAST);
+  CHECK_EQ(temp, 0);
+  CHECK_EQ(level, 1);
+  CHECK_EQ(idle, 2);
+
+  // Aggregates are computed incrementally
+  const float temps[] = {21.5f, 19.0f, 23.25f, 20.0f};
+  for (float t : temps) {
+    CHECK(samples.addSample(temp, t));
+  }
+  CHECK(samples.addSample(level, 2.0f));
+  CHECK(samples.addSample(level, 4.0f));
+  CHECK(!samples.addSample(level, NAN));  // Non-finite values are rejected
+  CHECK(!samples.addSample(9, 1.0f));     // Invalid channel
+
+  SampleSummary summary;
+  CHECK(samples.getSummary(temp, summary));
+  CHECK(summary.min == 19.0f);
+  CHECK(summary.max == 23.25f);
+  CHECK(fabs(summary.mean - 20.9375f) < 1e-6);
+  CHECK(summary.last == 20.0f);
+  CHECK_EQ(summary.count, 4);
+  CHECK(!samples.getSummary(idle, summary));
+
+  // One payload per window (unsampled channels are left out)
+  CHECK(!samples.due());
+  g_millis += 10000;
+  CHECK(samples.due());
+  client.respond("204 No Content");
+  CHECK(samples.report(exosite, "data_in").success);
+  std::string body = requestBody(client);
+  CHECK_STR(body.c_str(),
+            "data_in=%7B%22001_min%22%3A19.0%2C%22001_max%22%3A23.3%2C%22001_mean%22%3A20.9%2C"
+            "%22001_last%22%3A20.0%2C%22001_count%22%3A4%2C%22002%22%3A3.00%7D\r\n");
+
+  // A new window starts after a successful report
+  CHECK(!samples.due());
+  CHECK(!samples.getSummary(temp, summary));
+
+  // A failed report keeps the window's samples for the next one
+  samples.addSample(level, 1.0f);
+  g_millis += 10000;
+  client.respond("500 Internal Server Error");
+  CHECK(!samples.report(exosite, "data_in").success);
+  samples.addSample(level, 3.0f);
+  CHECK(samples.getSummary(level, summary));
+  CHECK_EQ(summary.count, 2);
+  CHECK(summary.mean == 2.0f);
+
+  // Nothing to report
+  samples.reset();
+  ApiResponse res = samples.report(exosite, "data_in");
+  CHECK(res.success && res.statusCode == 0);
+
+  // Full buffer
+  for (int i = 3; i < EXO_SAMPLE_MAX_CHANNELS; i++) {
+    CHECK(samples.addChannel("xxx") >= 0);
+  }
+  CHECK_EQ(samples.addChannel("full"), -1);
+
+  return testResult("sample_buffer");
+}
@@ -0,0 +1,69 @@
+// Prioritized write queue (see: `ExositeScheduler`)
+#include "ExositeScheduler.h"
+#include "MockClient.h"
+#include "test.h"
+
+int main() {
+  MockClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  ExositeScheduler scheduler(exosite);
+
+  // Urgent writes are sent first, then the oldest write of the next class
+  CHECK(scheduler.submit("diag", "1", PRIORITY_BACKGROUND));
+  CHECK(scheduler.submit("data_in", "{\"001\":1}"));
+  CHECK(scheduler.submit("ack", "ok", PRIORITY_URGENT));
+  CHECK_EQ(scheduler.pending(), 3);
+
+  ApiResponse res;
+  client.batch = false;
+  for (int i = 0; i < 3; i++) {
+    client.respond("204 No Content");
+  }
+  CHECK(scheduler.process(&res) && res.success);
+  CHECK_EQ(client.count("POST"), 1);
+  CHECK(client.lastRequest().find("ack=ok") != std::string::npos);
+  CHECK(scheduler.process(&res));
+  CHECK(client.lastRequest().find("data_in=") != std::string::npos);
+  CHECK(scheduler.process(&res));
+  CHECK(client.lastRequest().find("diag=1") != std::string::npos);
+  CHECK(!scheduler.process(&res));
+
+  // A collapsed write keeps its queueing delay from the first value
+  unsigned long start = g_millis;
+  CHECK(scheduler.submit("data_in", "{\"001\":2}"));
+  g_millis += 1000;
+  CHECK(scheduler.submit("data_in", "{\"001\":3}"));
+  CHECK_EQ(scheduler.pending(), 1);
+  g_millis += 500;
+  client.respond("204 No Content");
+  CHECK(scheduler.process(&res));
+  CHECK(client.lastRequest().find("%22001%22%3A3") != std::string::npos);
+  SchedulerStats stats = scheduler.getStats(PRIORITY_NORMAL);
+  CHECK_EQ(stats.collapsed, 1);
+  CHECK(stats.maxDelayMs >= 1500 && stats.maxDelayMs < g_millis - start);
+
+  // ... while its deadline follows the newest value
+  CHECK(scheduler.submit("data_in", "{\"001\":4}", PRIORITY_NORMAL, 1000));
+  g_millis += 800;
+  CHECK(scheduler.submit("data_in", "{\"001\":5}", PRIORITY_NORMAL, 1000));
+  g_millis += 800;  // 1600 ms after the first value, 800 ms after the newest
+  client.respond("204 No Content");
+  CHECK(scheduler.process(&res) && res.success);
+  CHECK(client.lastRequest().find("%22001%22%3A5") != std::string::npos);
+
+  CHECK(scheduler.submit("data_in", "{\"001\":6}", PRIORITY_NORMAL, 1000));
+  g_millis += 800;
+  CHECK(scheduler.submit("data_in", "{\"001\":7}", PRIORITY_NORMAL, 500));
+  g_millis += 600;
+  CHECK(!scheduler.process(&res));
+  CHECK_EQ(scheduler.getStats(PRIORITY_NORMAL).expired, 1);
+
+  // Collapsing without a deadline clears it
+  CHECK(scheduler.submit("data_in", "{\"001\":8}", PRIORITY_NORMAL, 100));
+  CHECK(scheduler.submit("data_in", "{\"001\":9}"));
+  g_millis += 1000;
+  client.respond("204 No Content");
+  CHECK(scheduler.process(&res) && res.success);
+
+  return testResult("scheduler");
+}
@@ -0,0 +1,90 @@
+// TLS session cache hooks and connection instrumentation (see: `setSessionCache()`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "test.h"
+
+// Secure client simulating the cost of full vs. resumed handshakes
+struct MockSecureClient : public MockClient {
+  std::string serverSession = "s1"; // Session the server accepts for resumption
+  std::string offered;              // Session loaded before connecting
+  std::string established;          // Session of the current connection
+  bool wasResumed = false;
+
+  int connect(const char* host, uint16_t port) override {
+    wasResumed = !offered.empty() && offered == serverSession;
+    delay(wasResumed ? 150 : 2000);
+    established = serverSession;
+    offered.clear();
+    return MockClient::connect(host, port);
+  }
+};
+
+struct SessionCache : public TlsSessionCache {
+  std::string saved;
+  int saves = 0;
+
+  bool restore(Client* client, const char*) override {
+    if (saved.empty()) return false;
+    static_cast<MockSecureClient*>(client)->offered = saved;
+    return true;
+  }
+  void save(Client* client, const char*) override {
+    saved = static_cast<MockSecureClient*>(client)->established;
+    saves++;
+  }
+  bool resumed(Client* client) override {
+    return static_cast<MockSecureClient*>(client)->wasResumed;
+  }
+};
+
+int main() {
+  MockSecureClient client;
+  SessionCache cache;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  exosite.setSessionCache(&cache);
+
+  // First connection: full handshake, session saved
+  client.respond("204 No Content");
+  CHECK(exosite.write("data_in", "1").success);
+  ConnectionStats stats = exosite.getConnectionStats();
+  CHECK_EQ(stats.connects, 1);
+  CHECK_EQ(stats.sessionRestores, 0);
+  CHECK(stats.lastConnectMs >= 2000);
+  CHECK_EQ(cache.saves, 1);
+  CHECK_STR(cache.saved.c_str(), "s1");
+
+  // Reconnect: the cached session is resumed
+  client.open = false;
+  client.respond("204 No Content");
+  CHECK(exosite.write("data_in", "2").success);
+  stats = exosite.getConnectionStats();
+  CHECK_EQ(stats.connects, 2);
+  CHECK_EQ(stats.sessionRestores, 1);
+  CHECK_EQ(stats.sessionResumes, 1);
+  CHECK(stats.lastConnectMs >= 150 && stats.lastConnectMs < 2000);
+
+  // Server forgot the session: restored but not resumed, and the new session is saved
+  client.open = false;
+  client.serverSession = "s2";
+  client.respond("204 No Content");
+  CHECK(exosite.write("data_in", "3").success);
+  stats = exosite.getConnectionStats();
+  CHECK_EQ(stats.sessionRestores, 2);
+  CHECK_EQ(stats.sessionResumes, 1);
+  CHECK_STR(cache.saved.c_str(), "s2");
+
+  // Kept-alive connection: no handshake at all
+  client.respond("204 No Content");
+  CHECK(exosite.write("data_in", "4").success);
+  CHECK_EQ(exosite.getConnectionStats().connects, 3);
+
+  // Failed connection attempts are counted (and nothing is saved)
+  client.open = false;
+  client.refuse = true;
+  CHECK(!exosite.write("data_in", "5").success);
+  stats = exosite.getConnectionStats();
+  CHECK_EQ(stats.connectFailures, 1);
+  CHECK_EQ(cache.saves, 3);
+
+  return testResult("session_cache");
+}
@@ -0,0 +1,138 @@
+// Typed and zero-copy reads (see: `readInt()`, `readFloat()`, `readBool()`, `read(ValueView&)`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "test.h"
+
+static MockClient client;
+static ExositeHTTP exosite(&client, "example.com", "token");
+
+// Queues a response to the next read, holding the given (encoded) value
+static void respondValue(const char* value) {
+  client.respond("200 OK", std::string("data_out=") + value);
+}
+
+int main() {
+  // Integers
+  long number = 0;
+  respondValue("42");
+  CHECK(exosite.readInt("data_out", number).success);
+  CHECK_EQ(number, 42);
+  respondValue("-7");
+  CHECK(exosite.readInt("data_out", number).success);
+  CHECK_EQ(number, -7);
+
+  const char* notIntegers[] = {"12abc", "abc", "1.5", "%2012x", "99999999999999999999", "-99999999999999999999"};
+  for (const char* value : notIntegers) {
+    respondValue(value);
+    CHECK(!exosite.readInt("data_out", number).success);
+    CHECK_EQ(number, -7); // Unchanged
+  }
+
+  // Floating point numbers
+  float real = 0;
+  respondValue("2.41");
+  CHECK(exosite.readFloat("data_out", real).success);
+  CHECK(real == 2.41f);
+  respondValue("-1e-3");
+  CHECK(exosite.readFloat("data_out", real).success);
+  CHECK(real == -1e-3f);
+
+  const char* notFloats[] = {"2.41V", "x", "nan", "inf", "1e39", "-1e39"};
+  for (const char* value : notFloats) {
+    respondValue(value);
+    CHECK(!exosite.readFloat("data_out", real).success);
+    CHECK(real == -1e-3f);
+  }
+
+  // Booleans
+  const char* trueTokens[] = {"1", "true", "TRUE", "on", "On"};
+  for (const char* value : trueTokens) {
+    bool flag = false;
+    respondValue(value);
+    CHECK(exosite.readBool("data_out", flag).success);
+    CHECK(flag);
+  }
+  const char* falseTokens[] = {"0", "false", "False", "off", "OFF"};
+  for (const char* value : falseTokens) {
+    bool flag = true;
+    respondValue(value);
+    CHECK(exosite.readBool("data_out", flag).success);
+    CHECK(!flag);
+  }
+  const char* notBools[] = {"yes", "2", "onn", "true%20"};
+  for (const char* value : notBools) {
+    bool flag = true;
+    respondValue(value);
+    CHECK(!exosite.readBool("data_out", flag).success);
+    CHECK(flag);
+  }
+
+  // No value (HTTP 204) succeeds, leaving the values unchanged
+  bool flag = true;
+  client.respond("204 No Content");
+  ApiResponse res = exosite.readInt("data_out", number);
+  CHECK(res.success && res.statusCode == 204);
+  CHECK_EQ(number, -7);
+  client.respond("204 No Content");
+  CHECK(exosite.readFloat("data_out", real).success);
+  CHECK(real == -1e-3f);
+  client.respond("204 No Content");
+  CHECK(exosite.readBool("data_out", flag).success);
+  CHECK(flag);
+
+  // Other statuses fail
+  client.respond("404 Not Found");
+  CHECK(!exosite.readInt("data_out", number).success);
+
+  // Views are decoded in place, and valid until the next request
+  ValueView view;
+  respondValue("a%20b%26c");
+  res = exosite.read("data_out", view);
+  CHECK(res.success && res.statusCode == 200);
+  CHECK_STR(view.data, "a b&c");
+  CHECK_EQ(view.length, 5);
+  const char* data = view.data;
+  exosite.getReadCacheStats();
+  exosite.getBufferStats();
+  CHECK_STR(data, "a b&c");
+
+  respondValue("next");
+  CHECK(exosite.read("data_out", view).success);
+  CHECK(view.data == data); // The same internal buffer, now holding the next value
+  CHECK_STR(data, "next");
+
+  client.respond("204 No Content");
+  res = exosite.read("data_out", view);
+  CHECK(res.success && res.statusCode == 204);
+  CHECK_STR(view.data, "");
+  CHECK_EQ(view.length, 0);
+
+  client.respond("200 OK", "data_out");
+  CHECK(!exosite.read("data_out", view).success);
+  CHECK_EQ(view.length, 0);
+
+  // Unchanged values (HTTP 304) of cached resources are viewed (and parsed) from the cache
+  char cacheBuffer[16];
+  ReadCacheEntry cache[] = {{"data_out", cacheBuffer, sizeof(cacheBuffer), 0, false}};
+  exosite.setReadCache(cache, 1);
+  client.respond("200 OK", "data_out=17", "Last-Modified: 1700000000\r\n");
+  CHECK(exosite.read("data_out", view).success);
+
+  client.respond("304 Not Modified");
+  res = exosite.read("data_out", view);
+  CHECK(res.success && res.statusCode == 304);
+  CHECK(view.data == cacheBuffer);
+  CHECK_STR(view.data, "17");
+
+  client.respond("304 Not Modified");
+  res = exosite.readInt("data_out", number);
+  CHECK(res.success && res.statusCode == 304);
+  CHECK_EQ(number, 17);
+
+  // ...which fails if the resource is not cached
+  exosite.setReadCache(nullptr, 0);
+  client.respond("304 Not Modified");
+  CHECK(!exosite.read("data_out", view).success);
+
+  return testResult("typed_read");
+}
@@ -0,0 +1,119 @@
+// URL-encoding profiles of request bodies (see: `setEncoding()`)
+#include "ExositeHTTP.h"
+#include "MockClient.h"
+#include "test.h"
+
+static MockClient client;
+static ExositeHTTP exosite(&client, "example.com", "token");
+
+// Body of the last request (as counted by its Content-Length)
+static std::string lastBody() {
+  std::string request = client.lastRequest();
+  size_t length = strtoul(request.c_str() + request.find("Content-Length: ") + 16, nullptr, 10);
+  return request.substr(request.find("\r\n\r\n") + 4, length);
+}
+
+static int hexValue(char c) {
+  return isdigit((unsigned char)c) ? c - '0' : (toupper((unsigned char)c) - 'A' + 10);
+}
+
+// Decodes a form component as `application/x-www-form-urlencoded` parsers do (`+` as space)
+static std::string formDecode(const std::string& text) {
+  std::string result;
+  for (size_t i = 0; i < text.size(); i++) {
+    if (text[i] == '+') {
+      result += ' ';
+    }
+    else if (text[i] == '%' && i + 2 < text.size() && isxdigit((unsigned char)text[i + 1]) &&
+             isxdigit((unsigned char)text[i + 2])) {
+      result += (char)(hexValue(text[i + 1]) * 16 + hexValue(text[i + 2]));
+      i += 2;
+    }
+    else {
+      result += text[i];
+    }
+  }
+  return result;
+}
+
+// Writes the payload, checking that the body is a single pair decoding back to it
+static bool roundTrip(const char* payload) {
+  client.respond("204 No Content");
+  if (!exosite.write("data_in", payload).success) {
+    return false;
+  }
+
+  std::string body = lastBody();
+  size_t separator = body.find('=');
+  if (separator == std::string::npos || body.find('&') != std::string::npos ||
+      body.find('=', separator + 1) != std::string::npos) {
+    return false; // Significant characters of the payload left unescaped
+  }
+  return formDecode(body.substr(0, separator)) == "data_in" && formDecode(body.substr(separator + 1)) == payload;
+}
+
+// Length of the body of the example sketch's `data_in` payload (see: `writeChannels()`)
+static size_t exampleBody(UrlEncoding encoding) {
+  exosite.setEncoding(encoding);
+  exosite.beginChannels();
+  exosite.addChannel("001", 1);
+  exosite.addChannel("002", 0);
+  exosite.addChannel("003", 1);
+  exosite.addChannel("004", 0);
+  exosite.addChannel("005", 2.41f, 2);
+  client.respond("204 No Content");
+  CHECK(exosite.writeChannels("data_in").success);
+  return lastBody().size();
+}
+
+int main() {
+  // JSON punctuation is sent as-is
+  exosite.setEncoding(URL_ENCODING_MINIMAL);
+  CHECK(roundTrip("{\"001\":1,\"002\":2.41}"));
+  std::string body = lastBody();
+  CHECK_STR(body.c_str(), "data_in={\"001\":1,\"002\":2.41}");
+
+  // ...while characters significant in form bodies are escaped, and decode back
+  const char* payloads[] = {
+    "a&b=c",
+    "1+1=2",
+    "100% done",
+    "%41 is not A",
+    "{\"text\":\"spaces and\\ttabs\\n\",\"list\":[1, 2]}",
+    "tab\tnewline\r\nend",
+    "caf\xC3\xA9 \xE2\x82\xAC",  // UTF-8
+    "!\"#$'()*,/:;<>?@[\\]^`{|}~",
+    "",
+  };
+  for (const char* payload : payloads) {
+    CHECK(roundTrip(payload));
+  }
+
+  // Every byte (but NUL, ending the payload) round-trips
+  char bytes[256];
+  for (int i = 1; i < 256; i++) {
+    bytes[i - 1] = (char)i;
+  }
+  bytes[255] = '\0';
+  CHECK(roundTrip(bytes));
+
+  // The strict profile decodes to the same payloads
+  exosite.setEncoding(URL_ENCODING_STRICT);
+  for (const char* payload : payloads) {
+    CHECK(roundTrip(payload));
+  }
+  CHECK(roundTrip(bytes));
+  body = lastBody().substr(0, 14);
+  CHECK_STR(body.c_str(), "data_in=%01%02");
+
+  // Savings on the example sketch's payload: {"001":1,"002":0,"003":1,"004":0,"005":2.41}
+  size_t strict = exampleBody(URL_ENCODING_STRICT);
+  size_t minimal = exampleBody(URL_ENCODING_MINIMAL);
+  body = lastBody();
+  CHECK_STR(body.c_str(), "data_in={\"001\":1,\"002\":0,\"003\":1,\"004\":0,\"005\":2.41}");
+  CHECK(minimal < strict);
+  printf("url_encoding: example data_in body: %zu B strict, %zu B minimal (%zu B, %.0f%% smaller)\n",
+         strict, minimal, strict - minimal, 100.0 * (strict - minimal) / strict);
+
+  return testResult("url_encoding");
+}
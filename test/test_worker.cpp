@@ -0,0 +1,89 @@
+// Network-thread worker and its lock-free queues (see: `ExositeWorker`, `ExoSpscQueue`)
+#include "ExositeWorker.h"
+#include "MockClient.h"
+#include "test.h"
+#include <thread>
+
+int main() {
+  // Slots are released in publication order, across index wraparound
+  ExoSpscQueue<int, 4> queue;
+  CHECK(queue.front() == nullptr);
+  int next = 0, expected = 0;
+  for (int round = 0; round < 5; round++) {
+    while (int* slot = queue.back()) {
+      *slot = next++;
+      queue.push();
+    }
+    CHECK_EQ(queue.size(), 4);
+    for (int i = 0; i < 3; i++) {
+      CHECK_EQ(*queue.front(), expected++);
+      queue.pop();
+    }
+  }
+  while (int* slot = queue.front()) {
+    CHECK_EQ(*slot, expected++);
+    queue.pop();
+  }
+  CHECK_EQ(expected, next);
+  CHECK_EQ(queue.size(), 0);
+
+  // One producer and one consumer thread: every value is seen once and in order
+  static ExoSpscQueue<unsigned int, 8> shared;
+  const unsigned int count = 100000;
+  std::thread producer([&] {
+    for (unsigned int i = 0; i < count;) {
+      if (unsigned int* slot = shared.back()) {
+        *slot = i++;
+        shared.push();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  unsigned int received = 0, outOfOrder = 0;
+  while (received < count) {
+    if (unsigned int* slot = shared.front()) {
+      outOfOrder += *slot != received;
+      received++;
+      shared.pop();
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  CHECK_EQ(outOfOrder, 0);
+  CHECK(shared.front() == nullptr);
+
+  // Requests run in submission order and results carry their tags
+  MockClient client;
+  ExositeHTTP exosite(&client, "example.com", "token");
+  ExositeWorker worker(exosite);
+  client.respond("204 No Content");
+  client.respond("200 OK", "data_out=on");
+  CHECK(worker.submitWrite("data_in", "{\"001\":1}", 7));
+  CHECK(worker.submitRead("data_out", 8));
+  CHECK(!worker.submitRead(nullptr));
+  CHECK_EQ(worker.pending(), 2);
+
+  WorkerResult result;
+  CHECK(!worker.poll(result));
+  CHECK(worker.process());
+  CHECK(worker.process());
+  CHECK(!worker.process());
+  CHECK(worker.poll(result));
+  CHECK_EQ(result.tag, 7);
+  CHECK(!result.isRead && result.response.success);
+  CHECK(worker.poll(result));
+  CHECK_EQ(result.tag, 8);
+  CHECK(result.isRead && result.response.success);
+  CHECK_STR(result.value, "on");
+  CHECK(!worker.poll(result));
+
+  // Full request queue
+  for (int i = 0; i < EXO_WORKER_QUEUE_DEPTH; i++) {
+    CHECK(worker.submitRead("data_out"));
+  }
+  CHECK(!worker.submitRead("data_out"));
+
+  return testResult("worker");
+}